@@ -70,6 +70,7 @@ namespace pksm
         // [[nodiscard]] std::unique_ptr<PK6> convertToG6(Sav& save) const override;
         // [[nodiscard]] std::unique_ptr<PK7> convertToG7(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK8> convertToG8(Sav& save) const override;
+        [[nodiscard]] bool convertToG8(PK8& out, Sav& save) const;
 
         [[nodiscard]] std::unique_ptr<PKX> clone(void) const override;
 
@@ -35,11 +35,13 @@ namespace pksm
     class PK1 : public PKX
     {
     private:
-        u8* shiftedData;
         Language lang;
         GameVersion versionOfGame = GameVersion::RD; // not even PKHeX tries to do better
         bool japanese;
 
+        // The Pokemon's own data, past the list header the save's box lists wrap it in
+        [[nodiscard]] u8* shiftedData(void) const { return data + 3; }
+
         [[nodiscard]] int eggYear(void) const override { return 1900; }
 
         void eggYear(int) override {}
@@ -83,6 +85,7 @@ namespace pksm
         [[nodiscard]] std::unique_ptr<PK5> convertToG5(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK6> convertToG6(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK7> convertToG7(Sav& save) const override;
+        [[nodiscard]] bool convertToG7(PK7& out, Sav& save) const;
         // [[nodiscard]] std::unique_ptr<PB7> convertToLGPE(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK8> convertToG8(Sav& save) const override;
 
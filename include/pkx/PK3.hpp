@@ -83,6 +83,7 @@ namespace pksm
         [[nodiscard]] std::unique_ptr<PK1> convertToG1(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK2> convertToG2(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK4> convertToG4(Sav& save) const override;
+        [[nodiscard]] bool convertToG4(PK4& out, Sav& save) const;
         [[nodiscard]] std::unique_ptr<PK5> convertToG5(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK6> convertToG6(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK7> convertToG7(Sav& save) const override;
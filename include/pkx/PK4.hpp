@@ -68,7 +68,9 @@ namespace pksm
         [[nodiscard]] std::unique_ptr<PK1> convertToG1(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK2> convertToG2(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK3> convertToG3(Sav& save) const override;
+        [[nodiscard]] bool convertToG3(PK3& out, Sav& save) const;
         [[nodiscard]] std::unique_ptr<PK5> convertToG5(Sav& save) const override;
+        [[nodiscard]] bool convertToG5(PK5& out, Sav& save) const;
         [[nodiscard]] std::unique_ptr<PK6> convertToG6(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK7> convertToG7(Sav& save) const override;
         // std::unique_ptr<PB7> convertToLGPE(Sav& save) const override;
@@ -63,7 +63,9 @@ namespace pksm
         [[nodiscard]] std::unique_ptr<PK2> convertToG2(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK3> convertToG3(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK4> convertToG4(Sav& save) const override;
+        [[nodiscard]] bool convertToG4(PK4& out, Sav& save) const;
         [[nodiscard]] std::unique_ptr<PK6> convertToG6(Sav& save) const override;
+        [[nodiscard]] bool convertToG6(PK6& out, Sav& save) const;
         [[nodiscard]] std::unique_ptr<PK7> convertToG7(Sav& save) const override;
         // std::unique_ptr<PB7> convertToLGPE(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK8> convertToG8(Sav& save) const override;
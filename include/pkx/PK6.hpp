@@ -64,7 +64,9 @@ namespace pksm
         [[nodiscard]] std::unique_ptr<PK3> convertToG3(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK4> convertToG4(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK5> convertToG5(Sav& save) const override;
+        [[nodiscard]] bool convertToG5(PK5& out, Sav& save) const;
         [[nodiscard]] std::unique_ptr<PK7> convertToG7(Sav& save) const override;
+        [[nodiscard]] bool convertToG7(PK7& out, Sav& save) const;
         // std::unique_ptr<PB7> convertToLGPE(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK8> convertToG8(Sav& save) const override;
 
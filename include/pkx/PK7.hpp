@@ -68,8 +68,10 @@ namespace pksm
         [[nodiscard]] std::unique_ptr<PK4> convertToG4(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK5> convertToG5(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK6> convertToG6(Sav& save) const override;
+        [[nodiscard]] bool convertToG6(PK6& out, Sav& save) const;
         // std::unique_ptr<PKX> convertToLGPE(Sav& save) const override;
         [[nodiscard]] std::unique_ptr<PK8> convertToG8(Sav& save) const override;
+        [[nodiscard]] bool convertToG8(PK8& out, Sav& save) const;
 
         [[nodiscard]] std::unique_ptr<PKX> clone(void) const override;
 
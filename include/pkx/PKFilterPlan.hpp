@@ -0,0 +1,152 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef PKFILTERPLAN_HPP
+#define PKFILTERPLAN_HPP
+
+#include "enums/Generation.hpp"
+#include "enums/Stat.hpp"
+#include "pkx/PKFilter.hpp"
+#include "pkx/PKXView.hpp"
+#include "utils/coretypes.h"
+#include <array>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace pksm
+{
+    class Sav;
+
+    // A PKFilter compiled for the Pokemon of one generation. Every check PKXView can make turns
+    // into a comparison against a field of the decrypted slot data; level, ability, nature, gender
+    // and language are left to PKX::operator== on the decoded Pokemon, which is only done for
+    // slots that pass the rest. Either way, a slot matches exactly when operator== says it does
+    class PKFilterPlan
+    {
+    public:
+        using SlotList = std::vector<std::pair<u8, u8>>;
+
+        PKFilterPlan(const PKFilter& filter, Generation generation);
+
+        // False if the filter rules out every Pokemon of this generation
+        [[nodiscard]] bool possible(void) const { return !impossible; }
+
+        // True if a slot that passes matches must also be decoded and checked with operator==
+        [[nodiscard]] bool needsPKX(void) const { return residual; }
+
+        [[nodiscard]] const PKFilter& filter(void) const { return source; }
+
+        template <Generation::EnumType g>
+        [[nodiscard]] bool matches(const PKXView<g>& view) const
+        {
+            for (u8 i = 0; i < checkCount; i++)
+            {
+                const Check& check = checks[i];
+                // Whether the Pokemon fails the check when it isn't inversed
+                bool fails = false;
+                switch (check.field)
+                {
+                    case Field::SPECIES:
+                        fails = u16(view.species()) != check.value;
+                        break;
+                    case Field::FORM:
+                        fails = view.alternativeForm() != check.value;
+                        break;
+                    case Field::HELD_ITEM:
+                        fails = view.heldItem() != check.value;
+                        break;
+                    case Field::TSV:
+                        fails = view.TSV() != check.value;
+                        break;
+                    case Field::BALL:
+                        fails = u8(view.ball()) != check.value;
+                        break;
+                    case Field::EGG:
+                        fails = view.egg() != (check.value != 0);
+                        break;
+                    case Field::SHINY:
+                        fails = view.shiny() != (check.value != 0);
+                        break;
+                    case Field::MOVE:
+                        fails = u16(view.move(check.index)) != check.value;
+                        break;
+                    case Field::RELEARN_MOVE:
+                        fails = u16(view.relearnMove(check.index)) != check.value;
+                        break;
+                    case Field::IV:
+                        fails = view.iv(Stat(check.index)) < check.value;
+                        break;
+                }
+                if (check.inverse != fails)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Box slots of save that match filter, in order
+        [[nodiscard]] static SlotList search(const Sav& save, const PKFilter& filter);
+        // search for each of saves, with saves spread across threads
+        [[nodiscard]] static std::vector<SlotList> search(
+            std::span<const Sav* const> saves, const PKFilter& filter);
+
+    private:
+        enum class Field : u8
+        {
+            SPECIES,
+            FORM,
+            HELD_ITEM,
+            TSV,
+            BALL,
+            EGG,
+            SHINY,
+            MOVE,
+            RELEARN_MOVE,
+            IV
+        };
+
+        struct Check
+        {
+            Field field;
+            u8 index;
+            bool inverse;
+            u16 value;
+        };
+
+        void add(Field field, u8 index, bool inverse, u16 value);
+
+        PKFilter source;
+        // One for each field PKFilter has that PKXView can read
+        std::array<Check, 21> checks;
+        u8 checkCount   = 0;
+        bool impossible = false;
+        bool residual   = false;
+    };
+}
+
+#endif
@@ -93,6 +93,15 @@ namespace pksm
         u32 length = 0;
         u8* data;
 
+        // Large enough for the biggest format, a party PK8/PK9. Pokemon without direct access keep
+        // their data here instead of in a separate heap allocation
+        static constexpr size_t MAX_LENGTH = 0x158;
+        alignas(u32) u8 storage[MAX_LENGTH];
+
+        // Replaces this Pokemon's data with a copy of the given data, or zeroes if it's null, which
+        // must be of a length valid for this Pokemon's format, and decrypts it if necessary
+        void load(const u8* data, size_t length);
+
     public:
         static constexpr Species PKSM_MAX_SPECIES = Species::Annihilape;
 
@@ -108,6 +117,36 @@ namespace pksm
             return getPKM<typename GenToPkx<g>::PKX>(data, length, directAccess);
         }
 
+        // Decodes into an existing Pokemon instead of allocating a new one, so that one object can
+        // be reused for many reads. Returns false and leaves out untouched if out is not of
+        // generation g or length is not valid for it. In Gen I and II, length must also match out's.
+        // As with the other overloads, null data makes a blank Pokemon
+        template <Generation::EnumType g>
+        [[nodiscard]] static bool getPKM(PKX& out, const u8* data, size_t length)
+        {
+            using Pkm = typename GenToPkx<g>::PKX;
+            if (static_cast<Generation::EnumType>(out.generation()) != g)
+            {
+                return false;
+            }
+            if constexpr (g == Generation::ONE || g == Generation::TWO)
+            {
+                if (length != out.getLength())
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                if (Pkm::PARTY_LENGTH != length && Pkm::BOX_LENGTH != length)
+                {
+                    return false;
+                }
+            }
+            out.load(data, length);
+            return true;
+        }
+
         template <std::derived_from<::pksm::PKX> Pkm>
         [[nodiscard]] static std::unique_ptr<Pkm> getPKM(
             u8* data, size_t length, bool directAccess = false)
@@ -117,6 +156,7 @@ namespace pksm
                           std::is_same_v<typename GenToPkx<Generation::TWO>::PKX,
                               std::remove_cvref_t<Pkm>>)
             {
+                static_assert(Pkm::INT_LENGTH_WITH_NAMES <= MAX_LENGTH);
                 if (Pkm::JP_LENGTH_WITH_NAMES == length || Pkm::INT_LENGTH_WITH_NAMES == length)
                 {
                     return std::make_unique<Pkm>(PrivateConstructor{}, data,
@@ -129,6 +169,7 @@ namespace pksm
             }
             else
             {
+                static_assert(Pkm::PARTY_LENGTH <= MAX_LENGTH);
                 if (Pkm::PARTY_LENGTH == length || Pkm::BOX_LENGTH == length)
                 {
                     return std::make_unique<Pkm>(
@@ -172,6 +213,7 @@ namespace pksm
         [[nodiscard]] virtual std::unique_ptr<PK7> convertToG7(Sav& save) const;
         [[nodiscard]] virtual std::unique_ptr<PB7> convertToLGPE(Sav& save) const;
         [[nodiscard]] virtual std::unique_ptr<PK8> convertToG8(Sav& save) const;
+        [[nodiscard]] virtual std::unique_ptr<PK9> convertToG9(Sav& save) const;
         [[nodiscard]] virtual std::unique_ptr<PKX> clone(void) const = 0;
         [[nodiscard]] std::unique_ptr<PKX> partyClone(void) const;
 
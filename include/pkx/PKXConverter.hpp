@@ -0,0 +1,76 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef PKXCONVERTER_HPP
+#define PKXCONVERTER_HPP
+
+#include "enums/Generation.hpp"
+#include "pkx/PKX.hpp"
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace pksm
+{
+    class Sav;
+
+    // Converts Pokemon between generations one generation at a time, over the same route and with
+    // the same results as the convertToG* functions. Every step but the last decodes into scratch
+    // Pokemon kept by the converter, so a conversion allocates its result and nothing else instead
+    // of a new Pokemon per generation crossed. A converter must only be used by one thread at once
+    class PKXConverter
+    {
+    private:
+        std::unique_ptr<PK3> pk3;
+        std::unique_ptr<PK4> pk4;
+        std::unique_ptr<PK5> pk5;
+        std::unique_ptr<PK6> pk6;
+        std::unique_ptr<PK7> pk7;
+        // Gen II Pokemon come in two lengths, so the rare Gen III to I conversion allocates one
+        std::unique_ptr<PK2> pk2;
+
+        // The generation after from on the way to target, or target itself on the last step
+        [[nodiscard]] static Generation nextGeneration(Generation from, Generation target);
+        // Converts pk into the scratch Pokemon for generation next. Null if there's no converter
+        [[nodiscard]] const PKX* step(const PKX& pk, Generation next, Sav& save);
+
+    public:
+        PKXConverter();
+        ~PKXConverter();
+
+        // Null if pk can't be converted to target, exactly like the matching convertToG* call
+        [[nodiscard]] std::unique_ptr<PKX> convert(const PKX& pk, Generation target, Sav& save);
+
+        // Converts each of pks, in order, to target. Null entries and Pokemon that can't be
+        // converted give null results. Large batches are split across threads, each with its own
+        // converter; conversions that draw random numbers then draw them from that thread's
+        // generator
+        [[nodiscard]] static std::vector<std::unique_ptr<PKX>> convert(
+            std::span<const PKX* const> pks, Generation target, Sav& save);
+    };
+}
+
+#endif
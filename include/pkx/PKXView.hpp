@@ -0,0 +1,198 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef PKXVIEW_HPP
+#define PKXVIEW_HPP
+
+#include "enums/Ball.hpp"
+#include "enums/Generation.hpp"
+#include "enums/Move.hpp"
+#include "enums/Species.hpp"
+#include "enums/Stat.hpp"
+#include "pkx/PK3.hpp"
+#include "utils/coretypes.h"
+#include "utils/endian.hpp"
+#include "utils/ValueConverter.hpp"
+
+namespace pksm
+{
+    // Read-only access to the most commonly scanned fields of a decrypted Gen III-IX Pokemon,
+    // reading straight from memory it doesn't own with the same offsets as the matching PKX
+    // class. Nothing is virtual, so a whole save can be scanned without allocating or copying
+    template <Generation::EnumType g>
+    class PKXView
+    {
+        static_assert(g != Generation::ONE && g != Generation::TWO && g != Generation::UNUSED,
+            "Gen I and II Pokemon have no view");
+
+    private:
+        static constexpr bool GEN3  = g == Generation::THREE;
+        static constexpr bool GEN45 = g == Generation::FOUR || g == Generation::FIVE;
+        static constexpr bool GEN67 =
+            g == Generation::SIX || g == Generation::SEVEN || g == Generation::LGPE;
+
+        static constexpr size_t PID_OFFSET     = GEN3 || GEN45 ? 0x00 : GEN67 ? 0x18 : 0x1C;
+        static constexpr size_t TID_OFFSET     = GEN3 ? 0x04 : 0x0C;
+        static constexpr size_t IV_OFFSET      = GEN3 ? 0x48 : GEN45 ? 0x38 : GEN67 ? 0x74 : 0x8C;
+        static constexpr size_t MOVE_OFFSET    = GEN3 ? 0x2C : GEN45 ? 0x28 : GEN67 ? 0x5A : 0x72;
+        static constexpr size_t RELEARN_OFFSET = GEN67 ? 0x6A : 0x82;
+        // Gen III-V shiny values are 13 bits, later ones 12
+        static constexpr u8 SV_SHIFT = GEN3 || GEN45 ? 3 : 4;
+
+        const u8* data;
+
+    public:
+        // Boxed Pokemon of this generation take up this much space in the save
+        static constexpr size_t SLOT_LENGTH =
+            GEN3 ? 80 : GEN45 ? 136 : g == Generation::LGPE ? 260 : GEN67 ? 232 : 0x158;
+
+        explicit constexpr PKXView(const u8* data) : data(data) {}
+
+        [[nodiscard]] const u8* rawData(void) const { return data; }
+
+        [[nodiscard]] u32 PID(void) const
+        {
+            return LittleEndian::convertTo<u32>(data + PID_OFFSET);
+        }
+
+        [[nodiscard]] u16 TID(void) const
+        {
+            return LittleEndian::convertTo<u16>(data + TID_OFFSET);
+        }
+
+        [[nodiscard]] u16 SID(void) const
+        {
+            return LittleEndian::convertTo<u16>(data + TID_OFFSET + 2);
+        }
+
+        [[nodiscard]] Species species(void) const
+        {
+            if constexpr (GEN3)
+            {
+                return SpeciesConverter::g3ToNational(LittleEndian::convertTo<u16>(data + 0x20));
+            }
+            else
+            {
+                return Species{LittleEndian::convertTo<u16>(data + 0x08)};
+            }
+        }
+
+        [[nodiscard]] u16 alternativeForm(void) const
+        {
+            if constexpr (GEN3)
+            {
+                return species() == Species::Unown ? PK3::getUnownForm(PID()) : 0;
+            }
+            else if constexpr (GEN45)
+            {
+                return data[0x40] >> 3;
+            }
+            else if constexpr (GEN67)
+            {
+                return data[0x1D] >> 3;
+            }
+            else
+            {
+                return LittleEndian::convertTo<u16>(data + 0x24);
+            }
+        }
+
+        [[nodiscard]] u16 heldItem(void) const
+        {
+            if constexpr (GEN3)
+            {
+                return ItemConverter::g3ToNational(LittleEndian::convertTo<u16>(data + 0x22));
+            }
+            else
+            {
+                return LittleEndian::convertTo<u16>(data + 0x0A);
+            }
+        }
+
+        [[nodiscard]] Move move(u8 m) const
+        {
+            return Move{LittleEndian::convertTo<u16>(data + MOVE_OFFSET + m * 2)};
+        }
+
+        [[nodiscard]] Move relearnMove(u8 m) const
+        {
+            if constexpr (GEN3 || GEN45)
+            {
+                return Move::None;
+            }
+            else
+            {
+                return Move{LittleEndian::convertTo<u16>(data + RELEARN_OFFSET + m * 2)};
+            }
+        }
+
+        [[nodiscard]] u8 iv(Stat stat) const
+        {
+            u32 buffer = LittleEndian::convertTo<u32>(data + IV_OFFSET);
+            return u8((buffer >> 5 * u8(stat)) & 0x1F);
+        }
+
+        [[nodiscard]] bool egg(void) const
+        {
+            return ((LittleEndian::convertTo<u32>(data + IV_OFFSET) >> 30) & 0x1) == 1;
+        }
+
+        [[nodiscard]] Ball ball(void) const
+        {
+            if constexpr (GEN3)
+            {
+                return Ball{u8((LittleEndian::convertTo<u16>(data + 0x46) >> 11) & 0xF)};
+            }
+            else if constexpr (g == Generation::FOUR)
+            {
+                return data[0x83] > data[0x86] ? Ball{data[0x83]} : Ball{data[0x86]};
+            }
+            else if constexpr (g == Generation::FIVE)
+            {
+                return Ball{data[0x83]};
+            }
+            else if constexpr (GEN67)
+            {
+                return Ball{data[0xDC]};
+            }
+            else
+            {
+                return Ball{data[0x124]};
+            }
+        }
+
+        [[nodiscard]] u16 TSV(void) const { return (TID() ^ SID()) >> SV_SHIFT; }
+
+        [[nodiscard]] u16 PSV(void) const
+        {
+            return ((PID() >> 16) ^ (PID() & 0xFFFF)) >> SV_SHIFT;
+        }
+
+        [[nodiscard]] bool shiny(void) const { return TSV() == PSV(); }
+    };
+}
+
+#endif
@@ -35,14 +35,19 @@
 #include "enums/Language.hpp"
 #include "enums/Species.hpp"
 #include "pkx/PKX.hpp"
+#include "pkx/PKXView.hpp"
 #include "sav/Item.hpp"
+#include "sav/SlotIndex.hpp"
 #include "utils/coretypes.h"
 #include "utils/DateTime.hpp"
 #include "utils/VersionTables.hpp"
 #include "wcx/WCX.hpp"
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
+#include <span>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -50,7 +55,7 @@ namespace pksm
 {
     class Sav
     {
-    protected:
+    public:
         enum class Game
         {
             DP,
@@ -72,18 +77,86 @@ namespace pksm
             GS,
             C,
             SV
-        } game;
+        };
+
+        // How much of the file identify looked at before deciding
+        enum class Confidence
+        {
+            Size,      // Only the file length is known to belong to the game
+            Structure, // Block identifiers or list terminators are where the game puts them
+            Checksum   // A stored checksum matches the data it covers
+        };
+
+        struct SaveInfo
+        {
+            Game game;
+            Generation generation;
+            // Language::None when it can't be read without decrypting anything
+            Language language;
+            // Index of the save partition the game would load, or -1 if it only has one
+            int partition;
+            Confidence confidence;
+        };
+
+    protected:
+        Game game;
 
         int Box, Party, PokeDex, WondercardData, WondercardFlags;
         int PouchHeldItem, PouchKeyItem, PouchTMHM, PouchMedicine, PouchBerry;
 
         const std::shared_ptr<u8[]> data;
         const u32 length;
+
+        // Start offsets, in ascending order, of the checksummed blocks a save is split into. Saves
+        // that set this only have to recompute the checksums of blocks written to since the last
+        // resign; the rest leave it empty and always resign fully
+        std::span<const u32> checksumBlocks;
+        std::vector<bool> dirtyBlocks;
+
+        void trackChecksumBlocks(std::span<const u32> blockOffsets);
+        // Must be called by every mutator that writes to data, with the range it wrote to
+        void markDirty(size_t offset, size_t size = 1);
+        [[nodiscard]] bool blockDirty(size_t block) const;
+        [[nodiscard]] bool allBlocksDirty() const;
+        void clearDirty();
+
+        // Must be called by every write of a Pokemon to a box slot, with the Pokemon as written
+        void boxSlotWritten(const PKX& pk, u8 box, u8 slot);
+        // Must be called after moving Pokemon between box slots or rewriting them wholesale
+        void boxesRewritten();
+
+        using SlotVisitor = void (*)(void* context, u8 box, u8 slot, const u8* data);
+        // Calls visitor with the decrypted data of every box slot, in order. Returns false if the
+        // save's Pokemon have no PKXView
+        virtual bool visitBoxSlots(SlotVisitor visitor, void* context) const;
+        // For visitBoxSlots: hands entry to visitor as-is if it's decrypted, or a decrypted copy of
+        // it otherwise
+        void visitBoxSlot(SlotVisitor visitor, void* context, u8 box, u8 slot, const u8* entry,
+            size_t length) const;
+
+        template <Generation::EnumType g, typename Visitor>
+        bool visitSlotViews(Visitor& visitor) const
+        {
+            return visitBoxSlots(
+                [](void* context, u8 box, u8 slot, const u8* data)
+                { (*static_cast<Visitor*>(context))(box, slot, PKXView<g>(data)); },
+                &visitor);
+        }
+
         [[nodiscard]] static std::unique_ptr<Sav> checkGBType(
             const std::shared_ptr<u8[]>& dt, size_t length);
         [[nodiscard]] static std::unique_ptr<Sav> checkGBAType(const std::shared_ptr<u8[]>& dt);
         [[nodiscard]] static std::unique_ptr<Sav> checkDSType(const std::shared_ptr<u8[]>& dt);
-        [[nodiscard]] static bool validSequence(const std::shared_ptr<u8[]>& dt, size_t offset);
+        [[nodiscard]] static bool validSequence(std::span<const u8> dt, size_t offset);
+        [[nodiscard]] static std::optional<SaveInfo> identifyDS(std::span<const u8> dt);
+
+    private:
+        std::unique_ptr<SlotIndex> slotIndex;
+        // One bit per box slot, set while the slot is empty. Empty until first needed
+        mutable std::vector<u64> emptySlotBits;
+
+        [[nodiscard]] int slotsPerBox() const;
+        void buildEmptySlotBits() const;
 
     public:
         enum class Pouch
@@ -112,7 +185,9 @@ namespace pksm
             FORM,
             ABILITY,
             ITEM,
-            BALL
+            BALL,
+            CONVERSION, // The Pokemon can't be converted to this save's generation
+            SPACE       // Every box slot was already taken
         };
 
         virtual ~Sav() = default;
@@ -126,12 +201,37 @@ namespace pksm
         // Must be called to continue editing after calling finishEditing.
         // Not necessary directly after construction
         virtual void beginEditing(void) = 0;
+        // Writes the signed/encrypted form of the save into out, which must be at least
+        // getLength() bytes, and leaves the save ready for further editing. Returns false if out
+        // is too small. Saves whose on-disk form is encrypted produce the image without touching
+        // the live buffer; others are resigned in place first
+        [[nodiscard]] virtual bool exportSnapshot(std::span<u8> out);
 
         [[nodiscard]] BadTransferReason invalidTransferReason(const PKX& pk) const;
+        // The same check against a save of any version, given that version's legalityBits
+        [[nodiscard]] static BadTransferReason invalidTransferReason(const PKX& pk,
+            GameVersion version, Generation generation, const VersionTables::LegalityBits& bits);
+        // invalidTransferReason for each of pks, split across threads for large batches. Null
+        // entries are reported as OKAY
+        [[nodiscard]] std::vector<BadTransferReason> invalidTransferReasons(
+            std::span<const PKX* const> pks) const;
         [[nodiscard]] std::unique_ptr<PKX> transfer(const PKX& pk);
+        // Checks, converts, and stores each of pks in the first free box slot, in order, returning
+        // why each one couldn't be transferred. Conversions are grouped by source generation and
+        // run in parallel; the save itself is only written to afterwards. Null entries are
+        // reported as CONVERSION
+        [[nodiscard]] std::vector<BadTransferReason> transferAll(
+            std::span<const PKX* const> pks, bool applyTrade);
         [[nodiscard]] static bool isValidDSSave(const std::shared_ptr<u8[]>& dt);
+        // Works out what getSave would return without allocating or constructing anything
+        [[nodiscard]] static std::optional<SaveInfo> identify(std::span<const u8> dt);
         [[nodiscard]] static std::unique_ptr<Sav> getSave(
             const std::shared_ptr<u8[]>& dt, size_t length);
+        // Builds the save directly on top of a copy-on-write mapping of the file at path. Edits
+        // are not persisted until writeToFile is called
+        [[nodiscard]] static std::unique_ptr<Sav> getSave(const std::string& path);
+        // Writes the save buffer to path as-is. Call finishEditing first
+        [[nodiscard]] bool writeToFile(const std::string& path) const;
 
         [[nodiscard]] virtual u16 TID(void) const             = 0;
         virtual void TID(u16 v)                               = 0;
@@ -178,6 +278,40 @@ namespace pksm
         virtual void pkm(const PKX& pk, u8 slot)                              = 0;
         [[nodiscard]] virtual std::unique_ptr<PKX> pkm(u8 box, u8 slot) const = 0;
         virtual void pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)     = 0;
+        // Decode into a caller-owned Pokemon of this save's generation, e.g. one made with
+        // emptyPkm(), so that scanning many slots reuses one object. Returns false if out cannot
+        // hold the slot's Pokemon
+        [[nodiscard]] virtual bool pkmInto(PKX& out, u8 slot) const;
+        [[nodiscard]] virtual bool pkmInto(PKX& out, u8 box, u8 slot) const;
+        // Calls visitor(box, slot, view) for every box slot, where view is a PKXView of this save's
+        // generation, so visitor should take it as auto. Slots that are already decrypted in the
+        // save are read in place and others through a decrypted copy on the stack; nothing is
+        // allocated. Returns false without visiting anything for Gen I and II saves
+        template <typename Visitor>
+        bool forEachSlotView(Visitor visitor) const
+        {
+            switch (generation())
+            {
+                case Generation::THREE:
+                    return visitSlotViews<Generation::THREE>(visitor);
+                case Generation::FOUR:
+                    return visitSlotViews<Generation::FOUR>(visitor);
+                case Generation::FIVE:
+                    return visitSlotViews<Generation::FIVE>(visitor);
+                case Generation::SIX:
+                    return visitSlotViews<Generation::SIX>(visitor);
+                case Generation::SEVEN:
+                    return visitSlotViews<Generation::SEVEN>(visitor);
+                case Generation::LGPE:
+                    return visitSlotViews<Generation::LGPE>(visitor);
+                case Generation::EIGHT:
+                    return visitSlotViews<Generation::EIGHT>(visitor);
+                case Generation::NINE:
+                    return visitSlotViews<Generation::NINE>(visitor);
+                default:
+                    return false;
+            }
+        }
         virtual void trade(PKX& pk,
             const Date& date = Date::today()) const = 0; // Look into bank boolean parameter
         [[nodiscard]] virtual std::unique_ptr<PKX> emptyPkm() const = 0;
@@ -203,6 +337,37 @@ namespace pksm
         [[nodiscard]] virtual size_t maxWondercards(void) const = 0;
         [[nodiscard]] virtual Generation generation(void) const = 0;
 
+        [[nodiscard]] std::span<const int> itemList(void) const
+        {
+            return VersionTables::itemList(version());
+        }
+
+        [[nodiscard]] std::span<const Move> moveList(void) const
+        {
+            return VersionTables::moveList(version());
+        }
+
+        [[nodiscard]] std::span<const Species> speciesList(void) const
+        {
+            return VersionTables::speciesList(version());
+        }
+
+        [[nodiscard]] std::span<const Ability> abilityList(void) const
+        {
+            return VersionTables::abilityList(version());
+        }
+
+        [[nodiscard]] std::span<const Ball> ballList(void) const
+        {
+            return VersionTables::ballList(version());
+        }
+
+        [[nodiscard]] const VersionTables::LegalityBits& legalityBits(void) const
+        {
+            return VersionTables::legalityBits(version());
+        }
+
+        // Slower std::set versions of the above, built on first use
         [[nodiscard]] const std::set<int>& availableItems(void) const
         {
             return VersionTables::availableItems(version());
@@ -252,6 +417,31 @@ namespace pksm
         [[nodiscard]] u32 getLength() const { return length; }
 
         [[nodiscard]] const std::shared_ptr<u8[]>& rawData() const { return data; }
+        // Makes the next finishEditing recompute every checksum and rebuilds the slot index, if
+        // there is one. Must be called after writing to rawData() directly
+        void markAllDirty();
+
+        // Indexes what's in the boxes so that the slotsWith* queries take time proportional to the
+        // number of slots they return rather than to the size of the save. The index is kept up to
+        // date by every box write; before it's built, the queries find nothing
+        void buildSlotIndex();
+        void dropSlotIndex() { slotIndex.reset(); }
+        [[nodiscard]] bool hasSlotIndex() const { return slotIndex != nullptr; }
+        // Box and slot of each matching Pokemon, in no particular order
+        [[nodiscard]] std::span<const SlotIndex::Slot> slotsWithSpecies(
+            Species species, u16 form) const;
+        [[nodiscard]] std::span<const SlotIndex::Slot> slotsWithShiny() const;
+        [[nodiscard]] std::span<const SlotIndex::Slot> slotsWithTSV(u16 tsv) const;
+        [[nodiscard]] std::span<const SlotIndex::Slot> slotsWithBall(Ball ball) const;
+        [[nodiscard]] std::span<const SlotIndex::Slot> slotsWithHeldItem(u16 item) const;
+
+        // Empty box slots, numbered like maxSlot() counts them: box * 30 + slot from Gen III on,
+        // box * 20 + slot before. Answered from a bitmap of empty slots that is read from the
+        // species fields the first time it's needed and kept up to date by every box write. The
+        // slot functions return -1 if there's no such slot
+        [[nodiscard]] int firstFreeSlot() const { return nextFreeSlot(-1); }
+        [[nodiscard]] int nextFreeSlot(int after) const;
+        [[nodiscard]] int freeSlotCount() const;
     };
 }
 
@@ -54,7 +54,7 @@ namespace pksm
     public:
         Sav1(const std::shared_ptr<u8[]>& data, u32 length);
 
-        [[nodiscard]] static Game getVersion(const std::shared_ptr<u8[]>& dt);
+        [[nodiscard]] static Game getVersion(std::span<const u8> dt);
 
         void finishEditing(void) override;
 
@@ -60,8 +60,8 @@ namespace pksm
             std::tuple<GameVersion, Language, bool> versionAndLanguage);
 
         [[nodiscard]] static std::tuple<GameVersion, Language, bool> getVersion(
-            const std::shared_ptr<u8[]>& dt);
-        [[nodiscard]] static bool validList(const std::shared_ptr<u8[]>& dt, size_t ofs, u8 slot);
+            std::span<const u8> dt);
+        [[nodiscard]] static bool validList(std::span<const u8> dt, size_t ofs, u8 slot);
 
         void finishEditing(void) override;
 
@@ -54,8 +54,8 @@ namespace pksm
 
         void loadBlocks();
         [[nodiscard]] static std::array<int, BLOCK_COUNT> getBlockOrder(
-            const std::shared_ptr<u8[]>& dt, int ofs);
-        [[nodiscard]] static int getActiveSaveIndex(const std::shared_ptr<u8[]>& dt,
+            std::span<const u8> dt, int ofs);
+        [[nodiscard]] static int getActiveSaveIndex(std::span<const u8> dt,
             std::array<int, BLOCK_COUNT>& blockOrder1, std::array<int, BLOCK_COUNT>& blockOrder2);
 
         static constexpr u16 chunkLength[BLOCK_COUNT] = {
@@ -97,10 +97,16 @@ namespace pksm
         void setSeen(Species species, bool seen);
 
         Sav3(const std::shared_ptr<u8[]>& data, const std::vector<int>& seenFlagOffsets);
+        bool visitBoxSlots(SlotVisitor visitor, void* context) const override;
+        // Copies a Pokemon's box data into a slot, across sectors if the slot is split
+        void boxSlotData(u8 box, u8 slot, std::span<const u8> pkmData);
 
     public:
         static constexpr int SIZE_BLOCK = 0x1000;
-        [[nodiscard]] static Game getVersion(const std::shared_ptr<u8[]>& dt);
+        [[nodiscard]] static Game getVersion(std::span<const u8> dt);
+        [[nodiscard]] static Game getVersion(std::span<const u8> dt, int blockOfs0);
+        // Returns the active save index and the offset of its first block, in that order
+        [[nodiscard]] static std::pair<int, int> getActiveBlock0(std::span<const u8> dt);
 
         void resign(void);
 
@@ -165,6 +171,8 @@ namespace pksm
 
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 slot) const override;
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 box, u8 slot) const override;
+        [[nodiscard]] bool pkmInto(PKX& out, u8 slot) const override;
+        [[nodiscard]] bool pkmInto(PKX& out, u8 box, u8 slot) const override;
 
         // NOTICE: this sets a pkx into the savefile, not a ekx
         // that's because PKSM works with decrypted boxes and
@@ -59,10 +59,14 @@ namespace pksm
         };
 
         [[nodiscard]] static CountType compareCounters(u32 c1, u32 c2);
+        bool visitBoxSlots(SlotVisitor visitor, void* context) const override;
 
     public:
         Sav4(const std::shared_ptr<u8[]>& data, u32 length) : Sav(data, length) {}
 
+        // Returns 0 or 1 for whichever of the two partitions has the newer save counter at ofs
+        [[nodiscard]] static int activePartition(std::span<const u8> dt, int ofs);
+
         void resign(void);
 
         void finishEditing(void) override { resign(); }
@@ -120,6 +124,8 @@ namespace pksm
 
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 slot) const override;
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 box, u8 slot) const override;
+        [[nodiscard]] bool pkmInto(PKX& out, u8 slot) const override;
+        [[nodiscard]] bool pkmInto(PKX& out, u8 box, u8 slot) const override;
 
         // NOTICE: this sets a pkx into the savefile, not a ekx
         // that's because PKSM works with decrypted boxes and
@@ -40,6 +40,7 @@ namespace pksm
 
     private:
         [[nodiscard]] int dexFormIndex(int species, int formct) const;
+        bool visitBoxSlots(SlotVisitor visitor, void* context) const override;
 
     public:
         Sav6(const std::shared_ptr<u8[]>& data, u32 length) : Sav(data, length) {}
@@ -92,6 +93,8 @@ namespace pksm
 
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 slot) const override;
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 box, u8 slot) const override;
+        [[nodiscard]] bool pkmInto(PKX& out, u8 slot) const override;
+        [[nodiscard]] bool pkmInto(PKX& out, u8 box, u8 slot) const override;
 
         // NOTICE: this sets a pkx into the savefile, not a ekx
         // that's because PKSM works with decrypted boxes and
@@ -29,6 +29,7 @@
 
 #include "personal/personal.hpp"
 #include "sav/Sav.hpp"
+#include <array>
 
 namespace pksm
 {
@@ -37,6 +38,8 @@ namespace pksm
     protected:
         int TrainerCard, Misc, PlayTime, LastViewedBox, PokeDexLanguageFlags, PCLayout;
         int PouchZCrystals, BattleItems;
+        // Checksum table hash the save was last signed with, to skip signing when it's unchanged
+        std::optional<std::array<u8, 32>> signedChecksumHash;
 
         [[nodiscard]] virtual int dexFormIndex(int species, int formct, int start) const = 0;
         [[nodiscard]] virtual int dexFormCount(int species) const                        = 0;
@@ -45,6 +48,7 @@ namespace pksm
         void setDexFlags(int index, int gender, int shiny, int baseSpecies);
         [[nodiscard]] int getDexFlags(int index, int baseSpecies) const;
         bool sanitizeFormsToIterate(Species species, int& fs, int& fe, int formIn) const;
+        bool visitBoxSlots(SlotVisitor visitor, void* context) const override;
 
     public:
         Sav7(const std::shared_ptr<u8[]>& data, u32 length) : Sav(data, length) {}
@@ -98,6 +102,8 @@ namespace pksm
 
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 slot) const override;
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 box, u8 slot) const override;
+        [[nodiscard]] bool pkmInto(PKX& out, u8 slot) const override;
+        [[nodiscard]] bool pkmInto(PKX& out, u8 box, u8 slot) const override;
 
         // NOTICE: this sets a pkx into the savefile, not a ekx
         // that's because PKSM works with decrypted boxes and
@@ -36,7 +36,7 @@ namespace pksm
     class Sav8 : public Sav
     {
     protected:
-        std::vector<std::shared_ptr<pksm::crypto::swsh::SCBlock>> blocks;
+        pksm::crypto::swsh::SCBlockList blocks;
 
         int Items, BoxLayout, Misc, TrainerCard, PlayTime, Status;
 
@@ -46,9 +46,12 @@ namespace pksm
         Sav8(const std::shared_ptr<u8[]>& dt, size_t length);
 
         [[nodiscard]] std::shared_ptr<pksm::crypto::swsh::SCBlock> getBlock(u32 key) const;
+        // Like getBlock, but without reference counting. Returns nullptr if the key isn't present
+        [[nodiscard]] pksm::crypto::swsh::SCBlock* rawBlock(u32 key) const;
 
         void finishEditing(void) override;
         void beginEditing(void) override;
+        [[nodiscard]] bool exportSnapshot(std::span<u8> out) override;
 
         void trade(PKX& pk, const Date& date = Date::today()) const override;
         [[nodiscard]] std::unique_ptr<PKX> emptyPkm() const override;
@@ -10,7 +10,7 @@ namespace pksm
     class Sav9 : public Sav
     {
     protected:
-        std::vector<std::shared_ptr<pksm::crypto::swsh::SCBlock>> blocks;
+        pksm::crypto::swsh::SCBlockList blocks;
 
         int Items, BoxLayout, TrainerCard, PlayTime, Status, Money, LP;
 
@@ -20,9 +20,12 @@ namespace pksm
         Sav9(const std::shared_ptr<u8[]>& dt, size_t length);
 
         [[nodiscard]] std::shared_ptr<pksm::crypto::swsh::SCBlock> getBlock(u32 key) const;
+        // Like getBlock, but without reference counting. Returns nullptr if the key isn't present
+        [[nodiscard]] pksm::crypto::swsh::SCBlock* rawBlock(u32 key) const;
 
         void finishEditing(void) override;
         void beginEditing(void) override;
+        [[nodiscard]] bool exportSnapshot(std::span<u8> out) override;
 
         void trade(PKX& pk, const Date& date = Date::today()) const override;
         [[nodiscard]] std::unique_ptr<PKX> emptyPkm() const override;
@@ -52,6 +52,7 @@ namespace pksm
         int getDexFlags(int index, int baseSpecies) const;
         void setDexFlags(int index, int gender, int shiny, int baseSpecies);
         bool sanitizeFormsToIterate(Species species, int& fs, int& fe, int formIn) const;
+        bool visitBoxSlots(SlotVisitor visitor, void* context) const override;
 
     public:
         SavLGPE(const std::shared_ptr<u8[]>& dt, size_t length);
@@ -126,6 +127,8 @@ namespace pksm
         // Will never be encrypted: part of normal box stuff
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 slot) const override;
         [[nodiscard]] std::unique_ptr<PKX> pkm(u8 box, u8 slot) const override;
+        [[nodiscard]] bool pkmInto(PKX& out, u8 slot) const override;
+        [[nodiscard]] bool pkmInto(PKX& out, u8 box, u8 slot) const override;
 
         // NOTICE: this sets a pkx into the savefile, not a pkx
         // that's because PKSM works with decrypted boxes and
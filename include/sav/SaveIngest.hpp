@@ -0,0 +1,85 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef SAVEINGEST_HPP
+#define SAVEINGEST_HPP
+
+#include "pkx/PKX.hpp"
+#include "utils/coretypes.h"
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace pksm
+{
+    // Pulls every party and box Pokemon out of many saves at once
+    class SaveIngest
+    {
+    public:
+        enum class Error
+        {
+            OKAY,
+            READ,           // The file could not be opened or read
+            UNKNOWN_FORMAT, // Sav::getSave did not recognize the data
+            DECODE          // The save was recognized but threw while loading
+        };
+
+        struct Input
+        {
+            // Used when data is null
+            std::string path;
+            // Consumed: Sav8 and Sav9 decrypt this buffer in place
+            std::shared_ptr<u8[]> data = nullptr;
+            size_t length              = 0;
+        };
+
+        struct Entry
+        {
+            size_t input; // Index into the inputs passed to run
+            int box;      // -1 for party slots
+            u8 slot;
+            std::unique_ptr<PKX> pkm;
+        };
+
+        // Called on the worker thread that decoded the entry. Empty slots are skipped
+        using EntryCallback = std::function<void(Entry& entry)>;
+        // Called on the worker thread once a save is done with, whether it succeeded or not
+        using DoneCallback = std::function<void(size_t input, Error error)>;
+
+        // Each worker keeps at most one save alive at a time. threads == 0 uses every hardware
+        // thread. Returns one Error per input
+        [[nodiscard]] static std::vector<Error> run(std::span<const Input> inputs,
+            const EntryCallback& onEntry, const DoneCallback& onDone = nullptr,
+            unsigned int threads = 0);
+
+    private:
+        static Error ingest(const Input& input, size_t index, const EntryCallback& onEntry);
+    };
+}
+
+#endif
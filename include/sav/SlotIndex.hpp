@@ -0,0 +1,92 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef SLOTINDEX_HPP
+#define SLOTINDEX_HPP
+
+#include "enums/Ball.hpp"
+#include "enums/Species.hpp"
+#include "utils/coretypes.h"
+#include <array>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace pksm
+{
+    // Which box slots hold Pokemon of a species and form, shiny Pokemon, Pokemon with a TSV, ball
+    // or held item. Sav keeps one up to date as slots are written; see Sav::buildSlotIndex
+    class SlotIndex
+    {
+    public:
+        using Slot = std::pair<u8, u8>;
+
+        // The indexed fields of one Pokemon
+        struct Key
+        {
+            Species species = Species::None;
+            u16 form        = 0;
+            bool shiny      = false;
+            u16 TSV         = 0;
+            Ball ball       = Ball::None;
+            u16 heldItem    = 0;
+
+            // pk may be a PKX or a PKXView
+            template <typename Pokemon>
+            [[nodiscard]] static Key of(const Pokemon& pk)
+            {
+                return {pk.species(), pk.alternativeForm(), pk.shiny(), pk.TSV(), pk.ball(),
+                    pk.heldItem()};
+            }
+        };
+
+        // Replaces whatever was indexed for the slot. Empty slots aren't indexed
+        void set(u8 box, u8 slot, const Key& key);
+
+        // The slots holding matching Pokemon, in no particular order
+        [[nodiscard]] std::span<const Slot> species(Species species, u16 form) const;
+        [[nodiscard]] std::span<const Slot> shiny(void) const { return shinySlots; }
+        [[nodiscard]] std::span<const Slot> TSV(u16 tsv) const;
+        [[nodiscard]] std::span<const Slot> ball(Ball ball) const { return ballSlots[u8(ball)]; }
+        [[nodiscard]] std::span<const Slot> heldItem(u16 item) const;
+
+    private:
+        void add(const Slot& slot, const Key& key);
+        void remove(const Slot& slot, const Key& key);
+
+        // Keyed by box << 8 | slot
+        std::unordered_map<u16, Key> keys;
+        // Keyed by species << 16 | form
+        std::unordered_map<u32, std::vector<Slot>> speciesSlots;
+        std::unordered_map<u16, std::vector<Slot>> tsvSlots;
+        std::unordered_map<u16, std::vector<Slot>> heldItemSlots;
+        std::array<std::vector<Slot>, 256> ballSlots;
+        std::vector<Slot> shinySlots;
+    };
+}
+
+#endif
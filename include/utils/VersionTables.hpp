@@ -33,16 +33,86 @@
 #include "enums/Generation.hpp"
 #include "enums/Move.hpp"
 #include "enums/Species.hpp"
+#include "utils/coretypes.h"
+#include <array>
+#include <bit>
 #include <set>
+#include <span>
 
 namespace pksm::VersionTables
 {
+    // Everything available in a version, in ascending order
+    [[nodiscard]] std::span<const int> itemList(GameVersion version);
+    [[nodiscard]] std::span<const Move> moveList(GameVersion version);
+    [[nodiscard]] std::span<const Species> speciesList(GameVersion version);
+    [[nodiscard]] std::span<const Ability> abilityList(GameVersion version);
+    [[nodiscard]] std::span<const Ball> ballList(GameVersion version);
+
+    // The same tables as std::sets, built on first use. Prefer the lists above, or legalityBits
+    // for membership tests
     [[nodiscard]] const std::set<int>& availableItems(GameVersion version);
     [[nodiscard]] const std::set<Move>& availableMoves(GameVersion version);
     [[nodiscard]] const std::set<Species>& availableSpecies(GameVersion version);
     [[nodiscard]] const std::set<Ability>& availableAbilities(GameVersion version);
     [[nodiscard]] const std::set<Ball>& availableBalls(GameVersion version);
 
+    // A std::bitset that can be filled in at compile time
+    template <size_t N>
+    class BitTable
+    {
+    private:
+        std::array<u64, (N + 63) / 64> words{};
+
+    public:
+        [[nodiscard]] static constexpr size_t size() { return N; }
+
+        constexpr void set(size_t i) { words[i / 64] |= u64(1) << (i % 64); }
+
+        [[nodiscard]] constexpr bool test(size_t i) const
+        {
+            return i < N && ((words[i / 64] >> (i % 64)) & 1) != 0;
+        }
+
+        [[nodiscard]] constexpr size_t count() const
+        {
+            size_t ret = 0;
+            for (u64 word : words)
+            {
+                ret += std::popcount(word);
+            }
+            return ret;
+        }
+    };
+
+    // The tables of one version as dense bitsets, for checking many values at once
+    struct LegalityBits
+    {
+        BitTable<2048> items;
+        BitTable<1024> moves;
+        BitTable<1024> species;
+        BitTable<512> abilities;
+        BitTable<64> balls;
+
+        [[nodiscard]] constexpr bool hasItem(int v) const { return v >= 0 && items.test(v); }
+
+        [[nodiscard]] constexpr bool hasMove(Move v) const { return moves.test(size_t(v)); }
+
+        [[nodiscard]] constexpr bool hasSpecies(Species v) const
+        {
+            return species.test(size_t(v));
+        }
+
+        [[nodiscard]] constexpr bool hasAbility(Ability v) const
+        {
+            return abilities.test(size_t(v));
+        }
+
+        [[nodiscard]] constexpr bool hasBall(Ball v) const { return balls.test(size_t(v)); }
+    };
+
+    // Generated at compile time, so this is just an index into a table
+    [[nodiscard]] const LegalityBits& legalityBits(GameVersion version);
+
     // Not guaranteed to be useful
     [[nodiscard]] int maxItem(GameVersion version);
     [[nodiscard]] Move maxMove(GameVersion version);
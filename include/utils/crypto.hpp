@@ -27,11 +27,13 @@
 #ifndef CRYPTO_HPP
 #define CRYPTO_HPP
 
+#include "enums/Generation.hpp"
 #include "utils/coretypes.h"
 #include <array>
 #include <memory>
 #include <span>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace pksm::crypto
@@ -45,7 +47,8 @@ namespace pksm::crypto
     [[nodiscard]] u32 sum32(std::span<const u8> data);
 
     // This SHA256 implementation is Brad Conte's. It has been modified to have a C++-style
-    // interface.
+    // interface. Blocks are compressed with the SHA extensions on x86 and ARMv8 when the CPU
+    // has them, and with the portable code otherwise.
     class SHA256
     {
     private:
@@ -54,7 +57,7 @@ namespace pksm::crypto
         u64 bitLength;
         std::array<u32, 8> state;
 
-        void update();
+        void transform(const u8* blocks, size_t count);
 
     public:
         SHA256() { reinitialize(); }
@@ -79,6 +82,7 @@ namespace pksm::crypto
         {
             friend std::vector<std::shared_ptr<SCBlock>> getBlockList(
                 std::shared_ptr<u8[]> data, size_t length);
+            friend class SCBlockList;
 
         public:
             enum class SCBlockType : u8
@@ -108,6 +112,9 @@ namespace pksm::crypto
             // Nop if in proper state
             void encrypt();
             void decrypt();
+            // Writes this block's encrypted form into image, a copy of the buffer this block lives
+            // in, without changing this block's own state
+            void encryptInto(std::span<u8> image) const;
 
             u8* decryptedData()
             {
@@ -115,6 +122,9 @@ namespace pksm::crypto
                 return rawData();
             }
 
+            SCBlock(SCBlock&&)            = default;
+            SCBlock& operator=(SCBlock&&) = default;
+
         private:
             SCBlock(std::shared_ptr<u8[]> data, size_t& offset);
             SCBlock(const SCBlock&)            = delete;
@@ -132,16 +142,53 @@ namespace pksm::crypto
             size_t dataLength;
             SCBlockType type;
             SCBlockType subtype;
-            bool currentlyEncrypted = false;
+            // Blocks start out encrypted; see getBlockList
+            bool currentlyEncrypted = true;
 
-            size_t encryptedDataSize();
+            size_t encryptedDataSize() const;
             static size_t arrayEntrySize(SCBlockType type);
             static size_t headerSize(SCBlockType type);
         };
 
+        // All of a save's blocks in one contiguous allocation, with an open-addressing index from
+        // key to block
+        class SCBlockList
+        {
+        public:
+            SCBlockList() = default;
+            SCBlockList(std::shared_ptr<u8[]> data, size_t length);
+
+            // Returns nullptr if there is no block with that key. The pointer is valid for as long
+            // as this list (or a block obtained from get()) is alive
+            [[nodiscard]] SCBlock* find(u32 key) const;
+            // Same as find, but shares ownership of the underlying storage
+            [[nodiscard]] std::shared_ptr<SCBlock> get(u32 key) const;
+
+            [[nodiscard]] size_t size() const { return blocks->size(); }
+            [[nodiscard]] std::vector<SCBlock>::iterator begin() { return blocks->begin(); }
+            [[nodiscard]] std::vector<SCBlock>::iterator end() { return blocks->end(); }
+
+        private:
+            struct IndexEntry
+            {
+                u32 key;
+                u32 block;
+            };
+
+            static constexpr u32 EMPTY_SLOT = 0xFFFFFFFF;
+
+            std::shared_ptr<std::vector<SCBlock>> blocks = std::make_shared<std::vector<SCBlock>>();
+            std::vector<IndexEntry> index;
+            int indexBits = 0;
+        };
+
         void applyXor(std::shared_ptr<u8[]> data, size_t length);
+        void applyXor(std::span<u8> data);
         void sign(std::shared_ptr<u8[]> data, size_t length);
+        void sign(std::span<u8> data);
         [[nodiscard]] bool verify(std::shared_ptr<u8[]> data, size_t length);
+        // Only parses block headers. Each block's data is decrypted in place the first time
+        // decryptedData() is called on it, so encrypting the list back only touches those blocks
         [[nodiscard]] std::vector<std::shared_ptr<SCBlock>> getBlockList(
             std::shared_ptr<u8[]> data, size_t length);
     }
@@ -182,17 +229,37 @@ namespace pksm::crypto
             }
         }
 
+        // XORs size bytes (a multiple of 2) with the keystream crypt() uses. The keystream is
+        // generated several words at a time from jump-ahead seeds, with SIMD where the CPU has it
+        void xorKeystream(u8* data, size_t size, u32 key);
+
         template <size_t Size>
         constexpr void crypt(u8* data, u32 key)
         {
-            for (size_t i = 0; i < Size; i += 2)
+            if (std::is_constant_evaluated())
             {
-                key         = seedStep(key);
-                data[i]     ^= (key >> 16);
-                data[i + 1] ^= (key >> 24);
+                for (size_t i = 0; i < Size; i += 2)
+                {
+                    key         = seedStep(key);
+                    data[i]     ^= (key >> 16);
+                    data[i + 1] ^= (key >> 24);
+                }
+            }
+            else
+            {
+                xorKeystream(data, Size, key);
             }
         }
 
+        // Decrypts (if crypted) or encrypts the stored Pokemon of generation gen packed back to
+        // back in data, each entryLength bytes long. The result is the same as opening each one
+        // with PKX::getPKM(..., true) and, if !crypted, encrypting it, without the allocations or
+        // virtual calls. Large ranges are split across threads
+        void cryptBoxData(Generation gen, std::span<u8> data, size_t entryLength, bool crypted);
+
+        // Whether a stored Pokemon of generation gen, as cryptBoxData would see it, is encrypted
+        [[nodiscard]] bool isEncrypted(Generation gen, const u8* entry);
+
         [[deprecated("Use the templated version wherever possible")]] constexpr void crypt(
             std::span<u8> data, u32 key)
         {
@@ -27,11 +27,21 @@
 #ifndef IO_HPP
 #define IO_HPP
 
+#include "utils/coretypes.h"
+#include <memory>
+#include <span>
 #include <string>
 
 namespace io
 {
     [[nodiscard]] bool exists(const std::string& name);
+    // Maps the file copy-on-write where the platform allows it, so changes to the returned buffer
+    // never reach the file on their own. Falls back to reading it into a heap buffer. Returns null
+    // and sets length to 0 on failure
+    [[nodiscard]] std::shared_ptr<u8[]> mapFile(const std::string& name, size_t& length);
+    // Writes data to the file in place without truncating it first, so that a mapping of the same
+    // file returned by mapFile stays valid while it is written back
+    [[nodiscard]] bool writeFile(const std::string& name, std::span<const u8> data);
 }
 
 #endif
@@ -29,12 +29,83 @@
 
 #include "utils/coretypes.h"
 #include <random>
+#include <span>
 
 namespace pksm
 {
     void seedRand(std::seed_seq& seed);
     void seedRand(u32 seed);
     [[nodiscard]] u32 randomNumber(u32 minInclusive, u32 maxInclusive);
+    // Fills out from the same generator as randomNumber, without going through it once per number
+    void randomNumbers(std::span<u32> out);
+    void randomNumbers(std::span<u32> out, u32 minInclusive, u32 maxInclusive);
+
+    // A PCG32 generator giving the same numbers as pcg-cpp's pcg32 with the same seed and stream.
+    // Unlike randomNumber's, it's seeded explicitly and belongs to whoever holds it, so handing
+    // each worker its own, e.g. split(worker index), gives results that don't depend on timing or
+    // on which thread does what. Generators on different streams are independent
+    class RandomStream
+    {
+    private:
+        static constexpr u64 MULTIPLIER = 6364136223846793005ULL;
+
+        u64 seed;
+        u64 increment;
+        u64 state;
+
+    public:
+        using result_type = u32;
+
+        constexpr explicit RandomStream(u64 seed, u64 stream = 0)
+            : seed(seed),
+              increment(stream << 1 | 1),
+              state((seed + increment) * MULTIPLIER + increment)
+        {
+        }
+
+        // The generator with the same seed on another stream
+        [[nodiscard]] constexpr RandomStream split(u64 stream) const
+        {
+            return RandomStream{seed, stream};
+        }
+
+        [[nodiscard]] static constexpr u32 min() { return 0; }
+        [[nodiscard]] static constexpr u32 max() { return 0xFFFFFFFF; }
+
+        constexpr u32 operator()()
+        {
+            u64 old        = state;
+            state          = old * MULTIPLIER + increment;
+            u32 xorshifted = ((old >> 18) ^ old) >> 27;
+            u32 rotation   = old >> 59;
+            return (xorshifted >> rotation) | (xorshifted << (-rotation & 31));
+        }
+
+        // Uniform in [minInclusive, maxInclusive], without the bias of taking a remainder
+        constexpr u32 number(u32 minInclusive, u32 maxInclusive)
+        {
+            u32 range = maxInclusive - minInclusive + 1;
+            if (range == 0)
+            {
+                return (*this)();
+            }
+            // Lemire's method: the high half of a 64-bit product, redrawn in the rare cases that
+            // would make some results likelier than others
+            u64 product = u64((*this)()) * range;
+            if (u32(product) < range)
+            {
+                u32 threshold = -range % range;
+                while (u32(product) < threshold)
+                {
+                    product = u64((*this)()) * range;
+                }
+            }
+            return minInclusive + u32(product >> 32);
+        }
+
+        void fill(std::span<u32> out);
+        void fill(std::span<u32> out, u32 minInclusive, u32 maxInclusive);
+    };
 }
 
 #endif
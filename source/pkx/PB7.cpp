@@ -1003,6 +1003,20 @@ namespace pksm
     std::unique_ptr<PK8> PB7::convertToG8(Sav& save) const
     {
         auto pk8 = PKX::getPKM<Generation::EIGHT>(nullptr, PK8::BOX_LENGTH);
+        if (convertToG8(*pk8, save))
+        {
+            return pk8;
+        }
+        return nullptr;
+    }
+
+    bool PB7::convertToG8(PK8& out, Sav& save) const
+    {
+        if (!PKX::getPKM<Generation::EIGHT>(out, nullptr, PK8::BOX_LENGTH))
+        {
+            return false;
+        }
+        PK8* pk8 = &out;
 
         // Note: Locale stuff does not transfer
         pk8->encryptionConstant(encryptionConstant());
@@ -1059,6 +1073,6 @@ namespace pksm
 
         pk8->refreshChecksum();
 
-        return pk8;
+        return true;
     }
 }
@@ -49,7 +49,6 @@ namespace pksm
     {
         this->japanese = japanese;
         lang           = japanese ? Language::JPN : Language::ENG;
-        shiftedData    = data + 3;
     }
 
     std::unique_ptr<PK2> PK1::convertToG2(Sav&) const
@@ -145,6 +144,20 @@ namespace pksm
     std::unique_ptr<PK7> PK1::convertToG7(Sav& save) const
     {
         auto pk7 = PKX::getPKM<Generation::SEVEN>(nullptr, PK7::BOX_LENGTH);
+        if (convertToG7(*pk7, save))
+        {
+            return pk7;
+        }
+        return nullptr;
+    }
+
+    bool PK1::convertToG7(PK7& out, Sav& save) const
+    {
+        if (!PKX::getPKM<Generation::SEVEN>(out, nullptr, PK7::BOX_LENGTH))
+        {
+            return false;
+        }
+        PK7* pk7 = &out;
 
         pk7->encryptionConstant(randomNumber(0, 0xFFFFFFFF));
         pk7->PID(randomNumber(0, 0xFFFFFFFF));
@@ -270,7 +283,7 @@ namespace pksm
 
         pk7->fixMoves();
         pk7->refreshChecksum();
-        return pk7;
+        return true;
     }
 
     std::unique_ptr<PK8> PK1::convertToG8(Sav& save) const
@@ -290,30 +303,30 @@ namespace pksm
 
     u16 PK1::TID() const
     {
-        return BigEndian::convertTo<u16>(shiftedData + 12);
+        return BigEndian::convertTo<u16>(shiftedData() + 12);
     }
 
     void PK1::TID(u16 v)
     {
-        BigEndian::convertFrom<u16>(shiftedData + 12, v);
+        BigEndian::convertFrom<u16>(shiftedData() + 12, v);
     }
 
     std::string PK1::nickname() const
     {
         return StringUtils::getString1(
-            shiftedData, 44 + (japanese ? 6 : 11), japanese ? 6 : 11, lang);
+            shiftedData(), 44 + (japanese ? 6 : 11), japanese ? 6 : 11, lang);
     }
 
     std::string PK1::nicknameTransporter() const
     {
         return StringUtils::getString1(
-            shiftedData, 44 + (japanese ? 6 : 11), japanese ? 6 : 11, lang, true);
+            shiftedData(), 44 + (japanese ? 6 : 11), japanese ? 6 : 11, lang, true);
     }
 
     void PK1::nickname(const std::string_view& v)
     {
         StringUtils::setString1(
-            shiftedData, v, 44 + (japanese ? 6 : 11), japanese ? 6 : 11, lang, japanese ? 6 : 11);
+            shiftedData(), v, 44 + (japanese ? 6 : 11), japanese ? 6 : 11, lang, japanese ? 6 : 11);
     }
 
     Language PK1::language() const
@@ -332,23 +345,23 @@ namespace pksm
 
     std::string PK1::otName() const
     {
-        return StringUtils::getString1(shiftedData, 44, japanese ? 6 : 11, lang);
+        return StringUtils::getString1(shiftedData(), 44, japanese ? 6 : 11, lang);
     }
 
     void PK1::otName(const std::string_view& v)
     {
-        StringUtils::setString1(shiftedData, v, 44, japanese ? 6 : 11, lang, japanese ? 6 : 11);
+        StringUtils::setString1(shiftedData(), v, 44, japanese ? 6 : 11, lang, japanese ? 6 : 11);
     }
 
     u8 PK1::speciesID1() const
     {
-        return shiftedData[0];
+        return shiftedData()[0];
     }
 
     void PK1::speciesID1(u8 v)
     {
         data[1]        = v;
-        shiftedData[0] = v;
+        shiftedData()[0] = v;
         writeG1Types();
 
         // do this now rather than never
@@ -370,25 +383,25 @@ namespace pksm
     // importing
     u8 PK1::catchRate() const
     {
-        return shiftedData[7];
+        return shiftedData()[7];
     }
 
     void PK1::catchRate(u8 v)
     {
-        shiftedData[7] = v;
+        shiftedData()[7] = v;
     }
 
     // experience is actually 3 bytes
     u32 PK1::experience() const
     {
-        return BigEndian::convertTo<u32>(shiftedData + 14) >> 8;
+        return BigEndian::convertTo<u32>(shiftedData() + 14) >> 8;
     }
 
     void PK1::experience(u32 v)
     {
-        shiftedData[14] = v >> 16;
-        shiftedData[15] = (v >> 8) & 0x00FF;
-        shiftedData[16] = v & 0x0000FF;
+        shiftedData()[14] = v >> 16;
+        shiftedData()[15] = (v >> 8) & 0x00FF;
+        shiftedData()[16] = v & 0x0000FF;
     }
 
     u16 PK1::ev(Stat ev) const
@@ -397,7 +410,7 @@ namespace pksm
         {
             ev = Stat::SPATK;
         }
-        return BigEndian::convertTo<u16>(shiftedData + 17 + 2 * u8(ev));
+        return BigEndian::convertTo<u16>(shiftedData() + 17 + 2 * u8(ev));
     }
 
     void PK1::ev(Stat ev, u16 v)
@@ -406,37 +419,37 @@ namespace pksm
         {
             ev = Stat::SPATK;
         }
-        BigEndian::convertFrom<u16>(shiftedData + 17 + 2 * u8(ev), v);
+        BigEndian::convertFrom<u16>(shiftedData() + 17 + 2 * u8(ev), v);
     }
 
     Move PK1::move(u8 move) const
     {
-        return Move{shiftedData[8 + move]};
+        return Move{shiftedData()[8 + move]};
     }
 
     void PK1::move(u8 move, Move v)
     {
-        shiftedData[8 + move] = u8(v);
+        shiftedData()[8 + move] = u8(v);
     }
 
     u8 PK1::PP(u8 move) const
     {
-        return u8(shiftedData[29 + move] & 0x3F);
+        return u8(shiftedData()[29 + move] & 0x3F);
     }
 
     void PK1::PP(u8 move, u8 v)
     {
-        shiftedData[29 + move] = u8((shiftedData[29 + move] & 0xC0) | (v & 0x3F));
+        shiftedData()[29 + move] = u8((shiftedData()[29 + move] & 0xC0) | (v & 0x3F));
     }
 
     u8 PK1::PPUp(u8 move) const
     {
-        return shiftedData[29 + move] >> 6;
+        return shiftedData()[29 + move] >> 6;
     }
 
     void PK1::PPUp(u8 move, u8 v)
     {
-        shiftedData[29 + move] = u8((v & 0xC0) | (shiftedData[29 + move] & 0x3F));
+        shiftedData()[29 + move] = u8((v & 0xC0) | (shiftedData()[29 + move] & 0x3F));
     }
 
     u8 PK1::iv(Stat iv) const
@@ -447,14 +460,14 @@ namespace pksm
                 return ((PK1::iv(Stat::ATK) & 0x01) << 3) | ((PK1::iv(Stat::DEF) & 0x01) << 2) |
                        ((PK1::iv(Stat::SPD) & 0x01) << 1) | (PK1::iv(Stat::SPATK) & 0x01);
             case Stat::ATK:
-                return (shiftedData[0x1B] & 0xF0) >> 4;
+                return (shiftedData()[0x1B] & 0xF0) >> 4;
             case Stat::DEF:
-                return shiftedData[0x1B] & 0x0F;
+                return shiftedData()[0x1B] & 0x0F;
             case Stat::SPD:
-                return (shiftedData[0x1C] & 0xF0) >> 4;
+                return (shiftedData()[0x1C] & 0xF0) >> 4;
             case Stat::SPATK:
             case Stat::SPDEF:
-                return shiftedData[0x1C] & 0x0F;
+                return shiftedData()[0x1C] & 0x0F;
             default:
                 return 0;
         }
@@ -469,17 +482,17 @@ namespace pksm
         switch (iv)
         {
             case Stat::ATK:
-                shiftedData[0x1B] = ((v & 0x0F) << 4) | (shiftedData[0x1B] & 0x0F);
+                shiftedData()[0x1B] = ((v & 0x0F) << 4) | (shiftedData()[0x1B] & 0x0F);
                 break;
             case Stat::DEF:
-                shiftedData[0x1B] = (shiftedData[0x1B] & 0xF0) | (v & 0x0F);
+                shiftedData()[0x1B] = (shiftedData()[0x1B] & 0xF0) | (v & 0x0F);
                 break;
             case Stat::SPD:
-                shiftedData[0x1C] = ((v & 0x0F) << 4) | (shiftedData[0x1C] & 0x0F);
+                shiftedData()[0x1C] = ((v & 0x0F) << 4) | (shiftedData()[0x1C] & 0x0F);
                 break;
             case Stat::SPATK:
             case Stat::SPDEF:
-                shiftedData[0x1C] = (shiftedData[0x1C] & 0xF0) | (v & 0x0F);
+                shiftedData()[0x1C] = (shiftedData()[0x1C] & 0xF0) | (v & 0x0F);
                 break;
             case Stat::HP:
             default:
@@ -645,14 +658,14 @@ namespace pksm
 
     int PK1::partyCurrHP() const
     {
-        return isParty() ? BigEndian::convertTo<u16>(shiftedData + 1) : -1;
+        return isParty() ? BigEndian::convertTo<u16>(shiftedData() + 1) : -1;
     }
 
     void PK1::partyCurrHP(u16 v)
     {
         if (isParty())
         {
-            BigEndian::convertFrom<u16>(shiftedData + 1, v);
+            BigEndian::convertFrom<u16>(shiftedData() + 1, v);
         }
     }
 
@@ -666,7 +679,7 @@ namespace pksm
         {
             stat = Stat::SPATK;
         }
-        return BigEndian::convertTo<u16>(shiftedData + 34 + 2 * u8(stat));
+        return BigEndian::convertTo<u16>(shiftedData() + 34 + 2 * u8(stat));
     }
 
     void PK1::partyStat(Stat stat, u16 v)
@@ -677,31 +690,31 @@ namespace pksm
             {
                 stat = Stat::SPATK;
             }
-            BigEndian::convertFrom<u16>(shiftedData + 34 + 2 * u8(stat), v);
+            BigEndian::convertFrom<u16>(shiftedData() + 34 + 2 * u8(stat), v);
         }
     }
 
     int PK1::partyLevel() const
     {
-        return isParty() ? shiftedData[33] : -1;
+        return isParty() ? shiftedData()[33] : -1;
     }
 
     void PK1::partyLevel(u8 v)
     {
         if (isParty())
         {
-            shiftedData[33] = v;
+            shiftedData()[33] = v;
         }
     }
 
     int PK1::boxLevel() const
     {
-        return shiftedData[3];
+        return shiftedData()[3];
     }
 
     void PK1::boxLevel(u8 v)
     {
-        shiftedData[3] = v;
+        shiftedData()[3] = v;
     }
 
     void PK1::updatePartyData()
@@ -715,9 +728,9 @@ namespace pksm
 
     void PK1::writeG1Types()
     {
-        shiftedData[5] =
+        shiftedData()[5] =
             type1() < Type::Steel ? u8(type1()) : (20 + (u8(type1()) - u8(Type::Fire)));
-        shiftedData[6] =
+        shiftedData()[6] =
             type2() < Type::Steel ? u8(type2()) : (20 + (u8(type2()) - u8(Type::Fire)));
     }
 
@@ -49,7 +49,6 @@ namespace pksm
     {
         this->japanese = japanese;
         lang           = japanese ? Language::JPN : Language::ENG;
-        shiftedData    = data + 3;
     }
 
     std::unique_ptr<PK1> PK2::convertToG1(Sav& save) const
@@ -151,6 +150,20 @@ namespace pksm
     std::unique_ptr<PK7> PK2::convertToG7(Sav& save) const
     {
         auto pk7 = PKX::getPKM<Generation::SEVEN>(nullptr, PK7::BOX_LENGTH);
+        if (convertToG7(*pk7, save))
+        {
+            return pk7;
+        }
+        return nullptr;
+    }
+
+    bool PK2::convertToG7(PK7& out, Sav& save) const
+    {
+        if (!PKX::getPKM<Generation::SEVEN>(out, nullptr, PK7::BOX_LENGTH))
+        {
+            return false;
+        }
+        PK7* pk7 = &out;
 
         pk7->encryptionConstant(randomNumber(0, 0xFFFFFFFF));
         pk7->PID(randomNumber(0, 0xFFFFFFFF));
@@ -285,7 +298,7 @@ namespace pksm
 
         pk7->fixMoves();
         pk7->refreshChecksum();
-        return pk7;
+        return true;
     }
 
     std::unique_ptr<PK8> PK2::convertToG8(Sav& save) const
@@ -328,30 +341,30 @@ namespace pksm
 
     u16 PK2::TID() const
     {
-        return BigEndian::convertTo<u16>(shiftedData + 6);
+        return BigEndian::convertTo<u16>(shiftedData() + 6);
     }
 
     void PK2::TID(u16 v)
     {
-        BigEndian::convertFrom<u16>(shiftedData + 6, v);
+        BigEndian::convertFrom<u16>(shiftedData() + 6, v);
     }
 
     std::string PK2::nickname() const
     {
         return StringUtils::getString2(
-            shiftedData, 48 + (japanese ? 6 : 11), japanese ? 6 : 11, lang);
+            shiftedData(), 48 + (japanese ? 6 : 11), japanese ? 6 : 11, lang);
     }
 
     std::string PK2::nicknameTransporter() const
     {
         return StringUtils::getString2(
-            shiftedData, 48 + (japanese ? 6 : 11), japanese ? 6 : 11, lang, true);
+            shiftedData(), 48 + (japanese ? 6 : 11), japanese ? 6 : 11, lang, true);
     }
 
     void PK2::nickname(const std::string_view& v)
     {
         StringUtils::setString2(
-            shiftedData, v, 48 + (japanese ? 6 : 11), japanese ? 6 : 11, lang, japanese ? 6 : 11);
+            shiftedData(), v, 48 + (japanese ? 6 : 11), japanese ? 6 : 11, lang, japanese ? 6 : 11);
     }
 
     Language PK2::language() const
@@ -379,22 +392,23 @@ namespace pksm
 
     std::string PK2::otName() const
     {
-        return StringUtils::getString2(shiftedData, 48, japanese ? 6 : 11, lang);
+        return StringUtils::getString2(shiftedData(), 48, japanese ? 6 : 11, lang);
     }
 
     void PK2::otName(const std::string_view& v)
     {
-        StringUtils::setString2(shiftedData, v, 48, japanese ? 6 : 11, lang, japanese ? 6 : 11, 0);
+        StringUtils::setString2(
+            shiftedData(), v, 48, japanese ? 6 : 11, lang, japanese ? 6 : 11, 0);
     }
 
     Species PK2::species() const
     {
-        return Species{shiftedData[0]};
+        return Species{shiftedData()[0]};
     }
 
     void PK2::species(Species v)
     {
-        shiftedData[0] = u8(v);
+        shiftedData()[0] = u8(v);
         if (!egg())
         {
             data[1] = u8(v);
@@ -407,22 +421,22 @@ namespace pksm
 
     u8 PK2::heldItem2() const
     {
-        return shiftedData[1];
+        return shiftedData()[1];
     }
 
     void PK2::heldItem2(u8 v)
     {
-        shiftedData[1] = v;
+        shiftedData()[1] = v;
     }
 
     u16 PK2::heldItem() const
     {
-        return ItemConverter::g2ToNational(shiftedData[1]);
+        return ItemConverter::g2ToNational(shiftedData()[1]);
     }
 
     void PK2::heldItem(u16 v)
     {
-        shiftedData[1] = ItemConverter::nationalToG2(v);
+        shiftedData()[1] = ItemConverter::nationalToG2(v);
     }
 
     void PK2::heldItem(const Item& item)
@@ -439,26 +453,26 @@ namespace pksm
 
     u32 PK2::experience() const
     {
-        return BigEndian::convertTo<u32>(shiftedData + 8) >> 8;
+        return BigEndian::convertTo<u32>(shiftedData() + 8) >> 8;
     }
 
     void PK2::experience(u32 v)
     {
-        shiftedData[8]  = v >> 16;
-        shiftedData[9]  = (v >> 8) & 0x00FF;
-        shiftedData[10] = v & 0x0000FF;
+        shiftedData()[8]  = v >> 16;
+        shiftedData()[9]  = (v >> 8) & 0x00FF;
+        shiftedData()[10] = v & 0x0000FF;
 
-        shiftedData[31] = level();
+        shiftedData()[31] = level();
     }
 
     u8 PK2::otFriendship() const
     {
-        return shiftedData[27];
+        return shiftedData()[27];
     }
 
     void PK2::otFriendship(u8 v)
     {
-        shiftedData[27] = v;
+        shiftedData()[27] = v;
     }
 
     u16 PK2::ev(Stat ev) const
@@ -467,7 +481,7 @@ namespace pksm
         {
             ev = Stat::SPATK;
         }
-        return BigEndian::convertTo<u16>(shiftedData + 11 + 2 * u8(ev));
+        return BigEndian::convertTo<u16>(shiftedData() + 11 + 2 * u8(ev));
     }
 
     void PK2::ev(Stat ev, u16 v)
@@ -476,37 +490,37 @@ namespace pksm
         {
             ev = Stat::SPATK;
         }
-        BigEndian::convertFrom<u16>(shiftedData + 11 + 2 * u8(ev), v);
+        BigEndian::convertFrom<u16>(shiftedData() + 11 + 2 * u8(ev), v);
     }
 
     Move PK2::move(u8 move) const
     {
-        return Move{shiftedData[2 + move]};
+        return Move{shiftedData()[2 + move]};
     }
 
     void PK2::move(u8 move, Move v)
     {
-        shiftedData[2 + move] = u8(v);
+        shiftedData()[2 + move] = u8(v);
     }
 
     u8 PK2::PP(u8 move) const
     {
-        return u8(shiftedData[23 + move] & 0x3F);
+        return u8(shiftedData()[23 + move] & 0x3F);
     }
 
     void PK2::PP(u8 move, u8 v)
     {
-        shiftedData[23 + move] = u8((shiftedData[23 + move] & 0xC0) | (v & 0x3F));
+        shiftedData()[23 + move] = u8((shiftedData()[23 + move] & 0xC0) | (v & 0x3F));
     }
 
     u8 PK2::PPUp(u8 move) const
     {
-        return shiftedData[23 + move] >> 6;
+        return shiftedData()[23 + move] >> 6;
     }
 
     void PK2::PPUp(u8 move, u8 v)
     {
-        shiftedData[23 + move] = u8((v & 0xC0) | (shiftedData[23 + move] & 0x3F));
+        shiftedData()[23 + move] = u8((v & 0xC0) | (shiftedData()[23 + move] & 0x3F));
     }
 
     u8 PK2::iv(Stat iv) const
@@ -517,14 +531,14 @@ namespace pksm
                 return ((PK2::iv(Stat::ATK) & 0x01) << 3) | ((PK2::iv(Stat::DEF) & 0x01) << 2) |
                        ((PK2::iv(Stat::SPD) & 0x01) << 1) | (PK2::iv(Stat::SPATK) & 0x01);
             case Stat::ATK:
-                return (shiftedData[0x15] & 0xF0) >> 4;
+                return (shiftedData()[0x15] & 0xF0) >> 4;
             case Stat::DEF:
-                return shiftedData[0x15] & 0x0F;
+                return shiftedData()[0x15] & 0x0F;
             case Stat::SPD:
-                return (shiftedData[0x16] & 0xF0) >> 4;
+                return (shiftedData()[0x16] & 0xF0) >> 4;
             case Stat::SPATK:
             case Stat::SPDEF:
-                return shiftedData[0x16] & 0x0F;
+                return shiftedData()[0x16] & 0x0F;
             default:
                 return 0;
         }
@@ -539,17 +553,17 @@ namespace pksm
         switch (iv)
         {
             case Stat::ATK:
-                shiftedData[0x15] = ((v & 0x0F) << 4) | (shiftedData[0x15] & 0x0F);
+                shiftedData()[0x15] = ((v & 0x0F) << 4) | (shiftedData()[0x15] & 0x0F);
                 break;
             case Stat::DEF:
-                shiftedData[0x15] = (shiftedData[0x15] & 0xF0) | (v & 0x0F);
+                shiftedData()[0x15] = (shiftedData()[0x15] & 0xF0) | (v & 0x0F);
                 break;
             case Stat::SPD:
-                shiftedData[0x16] = ((v & 0x0F) << 4) | (shiftedData[0x16] & 0x0F);
+                shiftedData()[0x16] = ((v & 0x0F) << 4) | (shiftedData()[0x16] & 0x0F);
                 break;
             case Stat::SPATK:
             case Stat::SPDEF:
-                shiftedData[0x16] = (shiftedData[0x16] & 0xF0) | (v & 0x0F);
+                shiftedData()[0x16] = (shiftedData()[0x16] & 0xF0) | (v & 0x0F);
                 break;
             case Stat::HP:
             default:
@@ -657,12 +671,12 @@ namespace pksm
     // this data is generated in Crystal, preserved in Gold and Silver
     u16 PK2::catchData() const
     {
-        return BigEndian::convertTo<u16>(shiftedData + 29);
+        return BigEndian::convertTo<u16>(shiftedData() + 29);
     }
 
     void PK2::catchData(u16 v)
     {
-        BigEndian::convertFrom<u16>(shiftedData + 29, v);
+        BigEndian::convertFrom<u16>(shiftedData() + 29, v);
     }
 
     u16 PK2::metLocation() const
@@ -677,32 +691,32 @@ namespace pksm
 
     u8 PK2::pkrs() const
     {
-        return shiftedData[28];
+        return shiftedData()[28];
     }
 
     void PK2::pkrs(u8 v)
     {
-        shiftedData[28] = v;
+        shiftedData()[28] = v;
     }
 
     u8 PK2::pkrsDays() const
     {
-        return shiftedData[28] & 0xF;
+        return shiftedData()[28] & 0xF;
     }
 
     void PK2::pkrsDays(u8 v)
     {
-        shiftedData[28] = (shiftedData[28] & 0xF0) | v;
+        shiftedData()[28] = (shiftedData()[28] & 0xF0) | v;
     }
 
     u8 PK2::pkrsStrain() const
     {
-        return shiftedData[28] >> 4;
+        return shiftedData()[28] >> 4;
     }
 
     void PK2::pkrsStrain(u8 v)
     {
-        shiftedData[28] = (v << 4) | (shiftedData[28] & 0x0F);
+        shiftedData()[28] = (v << 4) | (shiftedData()[28] & 0x0F);
     }
 
     u8 PK2::metLevel() const
@@ -833,40 +847,40 @@ namespace pksm
 
     int PK2::partyCurrHP() const
     {
-        return isParty() ? BigEndian::convertTo<u16>(shiftedData + 34) : -1;
+        return isParty() ? BigEndian::convertTo<u16>(shiftedData() + 34) : -1;
     }
 
     void PK2::partyCurrHP(u16 v)
     {
         if (isParty())
         {
-            BigEndian::convertFrom<u16>(shiftedData + 34, v);
+            BigEndian::convertFrom<u16>(shiftedData() + 34, v);
         }
     }
 
     int PK2::partyStat(Stat stat) const
     {
-        return isParty() ? BigEndian::convertTo<u16>(shiftedData + 36 + 2 * u8(stat)) : -1;
+        return isParty() ? BigEndian::convertTo<u16>(shiftedData() + 36 + 2 * u8(stat)) : -1;
     }
 
     void PK2::partyStat(Stat stat, u16 v)
     {
         if (isParty())
         {
-            BigEndian::convertFrom<u16>(shiftedData + 36 + 2 * u8(stat), v);
+            BigEndian::convertFrom<u16>(shiftedData() + 36 + 2 * u8(stat), v);
         }
     }
 
     int PK2::partyLevel() const
     {
-        return isParty() ? shiftedData[31] : -1;
+        return isParty() ? shiftedData()[31] : -1;
     }
 
     void PK2::partyLevel(u8 v)
     {
         if (isParty())
         {
-            shiftedData[31] = v;
+            shiftedData()[31] = v;
         }
     }
 
@@ -740,7 +740,17 @@ namespace pksm
         return pk2;
     }
 
-    std::unique_ptr<PK4> PK3::convertToG4(Sav&) const
+    std::unique_ptr<PK4> PK3::convertToG4(Sav& save) const
+    {
+        auto pk4 = PKX::getPKM<Generation::FOUR>(nullptr, PK4::BOX_LENGTH);
+        if (convertToG4(*pk4, save))
+        {
+            return pk4;
+        }
+        return nullptr;
+    }
+
+    bool PK3::convertToG4(PK4& out, Sav&) const
     {
         static constexpr std::array<std::array<u8, 18>, 7> trashBytes = {
             {
@@ -760,7 +770,11 @@ namespace pksm
              }
         };
 
-        auto pk4 = PKX::getPKM<Generation::FOUR>(nullptr, PK4::BOX_LENGTH);
+        if (!PKX::getPKM<Generation::FOUR>(out, nullptr, PK4::BOX_LENGTH))
+        {
+            return false;
+        }
+        PK4* pk4 = &out;
 
         pk4->species(species());
         pk4->TID(TID());
@@ -888,7 +902,7 @@ namespace pksm
         pk4->fixMoves();
 
         pk4->refreshChecksum();
-        return pk4;
+        return true;
     }
 
     std::unique_ptr<PK5> PK3::convertToG5(Sav& save) const
@@ -1091,9 +1091,23 @@ namespace pksm
         return nullptr;
     }
 
-    std::unique_ptr<PK3> PK4::convertToG3(Sav&) const
+    std::unique_ptr<PK3> PK4::convertToG3(Sav& save) const
     {
         auto pk3 = PKX::getPKM<Generation::THREE>(nullptr, PK3::BOX_LENGTH);
+        if (convertToG3(*pk3, save))
+        {
+            return pk3;
+        }
+        return nullptr;
+    }
+
+    bool PK4::convertToG3(PK3& out, Sav&) const
+    {
+        if (!PKX::getPKM<Generation::THREE>(out, nullptr, PK3::BOX_LENGTH))
+        {
+            return false;
+        }
+        PK3* pk3 = &out;
 
         // This sets gender, nature, alternative form, and shininess as well
         pk3->PID(PKX::getRandomPID(species(), gender(), version(), nature(), alternativeForm(),
@@ -1198,12 +1212,26 @@ namespace pksm
         pk3->fixMoves();
 
         pk3->refreshChecksum();
-        return pk3;
+        return true;
     }
 
-    std::unique_ptr<PK5> PK4::convertToG5(Sav&) const
+    std::unique_ptr<PK5> PK4::convertToG5(Sav& save) const
     {
-        auto pk5 = PKX::getPKM<Generation::FIVE>(const_cast<u8*>(data), PK5::BOX_LENGTH);
+        auto pk5 = PKX::getPKM<Generation::FIVE>(nullptr, PK5::BOX_LENGTH);
+        if (convertToG5(*pk5, save))
+        {
+            return pk5;
+        }
+        return nullptr;
+    }
+
+    bool PK4::convertToG5(PK5& out, Sav&) const
+    {
+        if (!PKX::getPKM<Generation::FIVE>(out, data, PK5::BOX_LENGTH))
+        {
+            return false;
+        }
+        PK5* pk5 = &out;
 
         // Clear HGSS data
         LittleEndian::convertFrom<u16>(data + 0x86, 0);
@@ -1252,7 +1280,7 @@ namespace pksm
         pk5->fixMoves();
 
         pk5->refreshChecksum();
-        return pk5;
+        return true;
     }
 
     std::unique_ptr<PK6> PK4::convertToG6(Sav& save) const
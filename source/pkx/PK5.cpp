@@ -1126,7 +1126,21 @@ namespace pksm
 
     std::unique_ptr<PK4> PK5::convertToG4(Sav& save) const
     {
-        auto pk4 = PKX::getPKM<Generation::FOUR>(const_cast<u8*>(data), PK4::BOX_LENGTH);
+        auto pk4 = PKX::getPKM<Generation::FOUR>(nullptr, PK4::BOX_LENGTH);
+        if (convertToG4(*pk4, save))
+        {
+            return pk4;
+        }
+        return nullptr;
+    }
+
+    bool PK5::convertToG4(PK4& out, Sav& save) const
+    {
+        if (!PKX::getPKM<Generation::FOUR>(out, data, PK4::BOX_LENGTH))
+        {
+            return false;
+        }
+        PK4* pk4 = &out;
 
         // Clear nature field
         pk4->rawData()[0x41] = 0;
@@ -1154,12 +1168,26 @@ namespace pksm
         pk4->fixMoves();
 
         pk4->refreshChecksum();
-        return pk4;
+        return true;
     }
 
     std::unique_ptr<PK6> PK5::convertToG6(Sav& save) const
     {
         auto pk6 = PKX::getPKM<Generation::SIX>(nullptr, PK6::BOX_LENGTH);
+        if (convertToG6(*pk6, save))
+        {
+            return pk6;
+        }
+        return nullptr;
+    }
+
+    bool PK5::convertToG6(PK6& out, Sav& save) const
+    {
+        if (!PKX::getPKM<Generation::SIX>(out, nullptr, PK6::BOX_LENGTH))
+        {
+            return false;
+        }
+        PK6* pk6 = &out;
 
         pk6->encryptionConstant(PID());
         pk6->species(species());
@@ -1368,7 +1396,7 @@ namespace pksm
         pk6->nickname(StringUtils::UCS2toUTF8(toFix));
 
         pk6->refreshChecksum();
-        return pk6;
+        return true;
     }
 
     std::unique_ptr<PK3> PK5::convertToG3(Sav& save) const
@@ -1326,6 +1326,20 @@ namespace pksm
     std::unique_ptr<PK5> PK6::convertToG5(Sav& save) const
     {
         auto pk5 = PKX::getPKM<Generation::FIVE>(nullptr, PK5::BOX_LENGTH);
+        if (convertToG5(*pk5, save))
+        {
+            return pk5;
+        }
+        return nullptr;
+    }
+
+    bool PK6::convertToG5(PK5& out, Sav& save) const
+    {
+        if (!PKX::getPKM<Generation::FIVE>(out, nullptr, PK5::BOX_LENGTH))
+        {
+            return false;
+        }
+        PK5* pk5 = &out;
 
         pk5->species(species());
         pk5->TID(TID());
@@ -1434,12 +1448,26 @@ namespace pksm
         }
 
         pk5->refreshChecksum();
-        return pk5;
+        return true;
     }
 
     std::unique_ptr<PK7> PK6::convertToG7(Sav& save) const
     {
-        auto pk7 = PKX::getPKM<Generation::SEVEN>(const_cast<u8*>(data), PK7::BOX_LENGTH);
+        auto pk7 = PKX::getPKM<Generation::SEVEN>(nullptr, PK7::BOX_LENGTH);
+        if (convertToG7(*pk7, save))
+        {
+            return pk7;
+        }
+        return nullptr;
+    }
+
+    bool PK6::convertToG7(PK7& out, Sav& save) const
+    {
+        if (!PKX::getPKM<Generation::SEVEN>(out, data, PK7::BOX_LENGTH))
+        {
+            return false;
+        }
+        PK7* pk7 = &out;
 
         // markvalue field moved, clear old gen 6 data
         pk7->rawData()[0x2A] = 0;
@@ -1491,7 +1519,7 @@ namespace pksm
         pk7->currentHandler(1);
 
         pk7->refreshChecksum();
-        return pk7;
+        return true;
     }
 
     std::unique_ptr<PK8> PK6::convertToG8(Sav& save) const
@@ -1236,7 +1236,21 @@ namespace pksm
 
     std::unique_ptr<PK6> PK7::convertToG6(Sav& save) const
     {
-        auto pk6 = PKX::getPKM<Generation::SIX>(const_cast<u8*>(data), PK6::BOX_LENGTH);
+        auto pk6 = PKX::getPKM<Generation::SIX>(nullptr, PK6::BOX_LENGTH);
+        if (convertToG6(*pk6, save))
+        {
+            return pk6;
+        }
+        return nullptr;
+    }
+
+    bool PK7::convertToG6(PK6& out, Sav& save) const
+    {
+        if (!PKX::getPKM<Generation::SIX>(out, data, PK6::BOX_LENGTH))
+        {
+            return false;
+        }
+        PK6* pk6 = &out;
 
         // markvalue field moved, clear old gen 7 data
         LittleEndian::convertFrom<u16>(data + 0x16, 0);
@@ -1284,12 +1298,26 @@ namespace pksm
         pk6->fixMoves();
 
         pk6->refreshChecksum();
-        return pk6;
+        return true;
     }
 
     std::unique_ptr<PK8> PK7::convertToG8(Sav& save) const
     {
         auto pk8 = PKX::getPKM<Generation::EIGHT>(nullptr, PK8::BOX_LENGTH);
+        if (convertToG8(*pk8, save))
+        {
+            return pk8;
+        }
+        return nullptr;
+    }
+
+    bool PK7::convertToG8(PK8& out, Sav& save) const
+    {
+        if (!PKX::getPKM<Generation::EIGHT>(out, nullptr, PK8::BOX_LENGTH))
+        {
+            return false;
+        }
+        PK8* pk8 = &out;
 
         // Note: Locale stuff does not transfer
         pk8->encryptionConstant(encryptionConstant());
@@ -1411,7 +1439,7 @@ namespace pksm
 
         pk8->refreshChecksum();
 
-        return pk8;
+        return true;
     }
 
     int PK7::partyCurrHP(void) const
@@ -0,0 +1,189 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "pkx/PKFilterPlan.hpp"
+#include "pkx/PKX.hpp"
+#include "sav/Sav.hpp"
+#include <algorithm>
+#include <atomic>
+
+#ifndef _PKSMCORE_CONFIGURED
+#include "PKSMCORE_CONFIG.h"
+#endif
+
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+#include <thread>
+#endif
+
+namespace pksm
+{
+    PKFilterPlan::PKFilterPlan(const PKFilter& filter, Generation generation) : source(filter)
+    {
+        if (filter.generationEnabled() &&
+            (filter.generationInversed() != (generation != filter.generation())))
+        {
+            impossible = true;
+        }
+
+        if (filter.speciesEnabled())
+        {
+            add(Field::SPECIES, 0, filter.speciesInversed(), u16(filter.species()));
+        }
+        if (filter.alternativeFormEnabled())
+        {
+            add(Field::FORM, 0, filter.alternativeFormInversed(), filter.alternativeForm());
+        }
+        if (filter.heldItemEnabled())
+        {
+            add(Field::HELD_ITEM, 0, filter.heldItemInversed(), filter.heldItem());
+        }
+        if (filter.TSVEnabled())
+        {
+            add(Field::TSV, 0, filter.TSVInversed(), filter.TSV());
+        }
+        if (filter.ballEnabled())
+        {
+            add(Field::BALL, 0, filter.ballInversed(), u8(filter.ball()));
+        }
+        if (filter.eggEnabled())
+        {
+            add(Field::EGG, 0, filter.eggInversed(), filter.egg());
+        }
+        if (filter.shinyEnabled())
+        {
+            add(Field::SHINY, 0, filter.shinyInversed(), filter.shiny());
+        }
+        for (u8 i = 0; i < 4; i++)
+        {
+            if (filter.moveEnabled(i))
+            {
+                add(Field::MOVE, i, filter.moveInversed(i), u16(filter.move(i)));
+            }
+            if (filter.relearnMoveEnabled(i))
+            {
+                // operator== fails every Pokemon from before relearn moves existed
+                if (generation < Generation::SIX)
+                {
+                    impossible = true;
+                }
+                add(Field::RELEARN_MOVE, i, filter.relearnMoveInversed(i),
+                    u16(filter.relearnMove(i)));
+            }
+        }
+        for (u8 i = 0; i < 6; i++)
+        {
+            if (filter.ivEnabled(Stat(i)))
+            {
+                add(Field::IV, i, filter.ivInversed(Stat(i)), filter.iv(Stat(i)));
+            }
+        }
+
+        residual = filter.levelEnabled() || filter.abilityEnabled() || filter.natureEnabled() ||
+                   filter.genderEnabled() || filter.languageEnabled();
+    }
+
+    void PKFilterPlan::add(Field field, u8 index, bool inverse, u16 value)
+    {
+        checks[checkCount++] = {field, index, inverse, value};
+    }
+
+    PKFilterPlan::SlotList PKFilterPlan::search(const Sav& save, const PKFilter& filter)
+    {
+        SlotList ret;
+        PKFilterPlan plan{filter, save.generation()};
+        if (!plan.possible())
+        {
+            return ret;
+        }
+
+        // Only decoded for slots the plan alone can't decide
+        std::unique_ptr<PKX> pk = plan.needsPKX() ? save.emptyPkm() : nullptr;
+        bool viewed             = save.forEachSlotView(
+            [&](u8 box, u8 slot, auto view)
+            {
+                if (plan.matches(view) &&
+                    (!pk || (save.pkmInto(*pk, box, slot) && *pk == filter)))
+                {
+                    ret.emplace_back(box, slot);
+                }
+            });
+
+        // Gen I and II Pokemon have no view
+        if (!viewed)
+        {
+            const int slotsPerBox = save.maxSlot() / save.maxBoxes();
+            for (int i = 0; i < save.maxSlot(); i++)
+            {
+                auto boxed = save.pkm(i / slotsPerBox, i % slotsPerBox);
+                if (boxed && *boxed == filter)
+                {
+                    ret.emplace_back(i / slotsPerBox, i % slotsPerBox);
+                }
+            }
+        }
+
+        return ret;
+    }
+
+    std::vector<PKFilterPlan::SlotList> PKFilterPlan::search(
+        std::span<const Sav* const> saves, const PKFilter& filter)
+    {
+        std::vector<SlotList> ret(saves.size());
+
+        // Saves vary a lot in size, so workers claim the next unsearched one instead of being
+        // handed fixed ranges
+        std::atomic<size_t> next = 0;
+        auto worker              = [&]()
+        {
+            for (size_t i = next++; i < saves.size(); i = next++)
+            {
+                if (saves[i])
+                {
+                    ret[i] = search(*saves[i], filter);
+                }
+            }
+        };
+
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+        worker();
+#else
+        size_t threads =
+            std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), saves.size());
+        std::vector<std::thread> pool;
+        for (size_t i = 1; i < threads; i++)
+        {
+            pool.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : pool)
+        {
+            thread.join();
+        }
+#endif
+
+        return ret;
+    }
+}
@@ -39,6 +39,150 @@
 #include "utils/endian.hpp"
 #include "utils/random.hpp"
 #include "utils/VersionTables.hpp"
+#include <array>
+#include <optional>
+
+namespace
+{
+    // Plain random PIDs getRandomPID tries before counting out a valid one. Enough that it rarely
+    // gets that far unless valid PIDs are very scarce
+    constexpr int PID_DRAWS = 64;
+
+    // The conditions getRandomPID puts on a PID
+    struct PIDConstraints
+    {
+        int nature;      // -1 if any nature will do
+        int unownForm;   // -1 unless the PID decides a Gen III Unown's form
+        u32 abilityBits; // Checked against PID & 0x00010001 unless unownForm is set
+        bool shiny;
+        u16 tsv;
+        int psvShift;
+        int genderRatio; // -1 if any gender will do
+        pksm::Gender gender;
+
+        [[nodiscard]] bool accepts(u32 pid) const
+        {
+            if (nature >= 0 && pid % 25 != u32(nature))
+            {
+                return false;
+            }
+            if (unownForm >= 0 ? pksm::PK3::getUnownForm(pid) != unownForm
+                               : (pid & 0x00010001) != abilityBits)
+            {
+                return false;
+            }
+            u16 psv = (pid >> 16 ^ (pid & 0xFFFF)) >> psvShift;
+            if ((tsv == psv) != shiny)
+            {
+                return false;
+            }
+            return genderRatio < 0 || pksm::PKX::genderFromRatio(pid, genderRatio) == gender;
+        }
+    };
+
+    // Bits 9, 8, 1 and 0 of half a PID, which between them hold that half's share of a Gen III
+    // Unown's form and of the ability bits
+    constexpr u8 form_bits(u16 half)
+    {
+        return (half >> 6 & 0xC) | (half & 0x3);
+    }
+
+    // Picks one of the PIDs c accepts, each with the same chance, in a fixed number of steps
+    // however few of them there are. For each low half, the high halves that complete it are
+    // counted from tables of how many high halves have each form_bits and each residue mod 25,
+    // less or plus the handful that make it shiny. Nullopt if no PID is accepted
+    std::optional<u32> count_out_pid(const PIDConstraints& c)
+    {
+        std::array<std::array<u32, 25>, 16> halves{};
+        for (u32 hi = 0; hi <= 0xFFFF; hi++)
+        {
+            halves[form_bits(hi)][hi % 25]++;
+        }
+
+        // Which form_bits of the high half work with each form_bits of the low one, and the high
+        // halves that have them, by residue and in total
+        std::array<u16, 16> allowed{};
+        std::array<std::array<u32, 25>, 16> matching{};
+        std::array<u32, 16> matchingTotal{};
+        for (u8 lo = 0; lo < 16; lo++)
+        {
+            for (u8 hi = 0; hi < 16; hi++)
+            {
+                u32 pid = u32((hi & 0xC) << 6 | (hi & 0x3)) << 16 | (lo & 0xC) << 6 | (lo & 0x3);
+                if (c.unownForm >= 0 ? pksm::PK3::getUnownForm(pid) == c.unownForm
+                                     : (pid & 0x00010000) == (c.abilityBits & 0x00010000))
+                {
+                    allowed[lo] |= 1 << hi;
+                    for (int r = 0; r < 25; r++)
+                    {
+                        matching[lo][r] += halves[hi][r];
+                        matchingTotal[lo] += halves[hi][r];
+                    }
+                }
+            }
+        }
+
+        const u32 shinyBase  = u32(c.tsv) << c.psvShift;
+        const u32 shinyCount = shinyBase <= 0xFFFF ? 1u << c.psvShift : 0;
+        auto completions     = [&](u16 lo) -> u32
+        {
+            if ((c.genderRatio >= 0 && pksm::PKX::genderFromRatio(lo, c.genderRatio) != c.gender) ||
+                (c.unownForm < 0 && (lo & 0x1) != (c.abilityBits & 0x1)))
+            {
+                return 0;
+            }
+            // 16 is the inverse of 11, which is 0x10000 mod 25
+            int residue = c.nature >= 0 ? (c.nature + 25 - lo % 25) * 16 % 25 : -1;
+            u16 bits    = allowed[form_bits(lo)];
+            u32 shinies = 0;
+            for (u32 i = 0; i < shinyCount; i++)
+            {
+                u16 hi = lo ^ (shinyBase | i);
+                if ((bits >> form_bits(hi) & 1) && (residue < 0 || hi % 25 == u32(residue)))
+                {
+                    shinies++;
+                }
+            }
+            if (c.shiny)
+            {
+                return shinies;
+            }
+            return (residue < 0 ? matchingTotal[form_bits(lo)] : matching[form_bits(lo)][residue]) -
+                   shinies;
+        };
+
+        // At most 2^16 completions for each of 2^16 low halves, but the ability or form bits
+        // always rule out some, so this fits
+        u32 total = 0;
+        for (u32 lo = 0; lo <= 0xFFFF; lo++)
+        {
+            total += completions(lo);
+        }
+        if (total == 0)
+        {
+            return std::nullopt;
+        }
+
+        u32 pick = pksm::randomNumber(0, total - 1);
+        for (u32 lo = 0; lo <= 0xFFFF; lo++)
+        {
+            u32 count = completions(lo);
+            if (pick >= count)
+            {
+                pick -= count;
+                continue;
+            }
+            for (u32 hi = 0; hi <= 0xFFFF; hi++)
+            {
+                if (c.accepts(hi << 16 | lo) && pick-- == 0)
+                {
+                    return hi << 16 | lo;
+                }
+            }
+        }
+        return std::nullopt;
+    }
+}
 
 namespace pksm
 {
@@ -68,13 +212,13 @@ namespace pksm
             }
             else
             {
-                this->data = new u8[length];
+                this->data = storage;
                 std::copy(data, data + length, this->data);
             }
         }
         else
         {
-            this->data = new u8[length];
+            this->data = storage;
             std::fill_n(this->data, length, 0);
             this->directAccess = false;
         }
@@ -83,16 +227,24 @@ namespace pksm
     PKX::PKX(const PKX& pk)
     {
         directAccess = false;
-        data         = new u8[length = pk.getLength()];
+        data         = storage;
+        length       = pk.getLength();
         std::copy(pk.data, pk.data + length, data);
     }
 
     PKX::PKX(PKX&& pk)
     {
-        data         = pk.data;
         length       = pk.length;
         directAccess = pk.directAccess;
-        pk.data      = nullptr;
+        if (directAccess)
+        {
+            data = pk.data;
+        }
+        else
+        {
+            data = storage;
+            std::copy(pk.data, pk.data + length, data);
+        }
     }
 
     PKX& PKX::operator=(const PKX& pk)
@@ -101,12 +253,9 @@ namespace pksm
         {
             return *this;
         }
-        if (!directAccess && data)
-        {
-            delete[] data;
-        }
         directAccess = false;
-        data         = new u8[length = pk.getLength()];
+        data         = storage;
+        length       = pk.getLength();
         std::copy(pk.data, pk.data + length, data);
         return *this;
     }
@@ -117,22 +266,38 @@ namespace pksm
         {
             return *this;
         }
-        if (!directAccess && data)
-        {
-            delete[] data;
-        }
-        data         = pk.data;
         length       = pk.length;
         directAccess = pk.directAccess;
-        pk.data      = nullptr;
+        if (directAccess)
+        {
+            data = pk.data;
+        }
+        else
+        {
+            data = storage;
+            std::copy(pk.data, pk.data + length, data);
+        }
         return *this;
     }
 
-    PKX::~PKX()
+    PKX::~PKX() {}
+
+    void PKX::load(const u8* data, size_t length)
     {
-        if (!directAccess && data)
+        directAccess = false;
+        this->data   = storage;
+        this->length = length;
+        if (data)
+        {
+            std::copy(data, data + length, this->data);
+        }
+        else
+        {
+            std::fill_n(this->data, length, 0);
+        }
+        if (isEncrypted())
         {
-            delete[] data;
+            decrypt();
         }
     }
 
@@ -406,45 +571,35 @@ namespace pksm
         u8 genderType = genderTypeFinder(u16(species));
         bool g3unown  = (originGame <= GameVersion::LG || gen == Generation::THREE) &&
                        species == Species::Unown;
-        u32 abilityBits = oldPid & (abilityNum == 2 ? 0x00010001 : 0);
-        int psvShift    = gen >= Generation::SIX ? 4 : 3;
-        while (true)
+        bool anyGender = genderType == 255 || genderType == 254 || genderType == 0 ||
+                         gender == Gender::Genderless;
+        PIDConstraints constraints{
+            .nature      = (Generation)originGame <= Generation::FOUR ? int(u8(nature)) : -1,
+            .unownForm   = g3unown ? form : -1,
+            .abilityBits = oldPid & (abilityNum == 2 ? 0x00010001 : 0),
+            .shiny       = shiny,
+            .tsv         = tsv,
+            .psvShift    = gen >= Generation::SIX ? 4 : 3,
+            .genderRatio = anyGender ? -1 : genderType,
+            .gender      = gender};
+
+        // Rejection sampling is quickest while valid PIDs are common, but a shiny Unown of a
+        // given nature and letter takes millions of draws on average. Past a few draws the PID is
+        // counted out instead. Either way, every valid PID is equally likely
+        for (int i = 0; i < PID_DRAWS; i++)
         {
             u32 possiblePID = pksm::randomNumber(0, 0xFFFFFFFF);
-            if ((Generation)originGame <= Generation::FOUR && (possiblePID % 25) != size_t(nature))
-            {
-                continue;
-            }
-
-            if (g3unown)
-            {
-                if (PK3::getUnownForm(possiblePID) != form)
-                {
-                    continue;
-                }
-            }
-            else if (abilityBits != (possiblePID & 0x00010001))
-            {
-                continue;
-            }
-
-            u16 psv = (possiblePID >> 16 ^ (possiblePID & 0xFFFF)) >> psvShift;
-            if ((tsv == psv) != shiny)
-            {
-                continue;
-            }
-
-            if (genderType == 255 || genderType == 254 || genderType == 0 ||
-                gender == Gender::Genderless)
-            {
-                return possiblePID;
-            }
-
-            if (gender == genderFromRatio(possiblePID, genderType))
+            if (constraints.accepts(possiblePID))
             {
                 return possiblePID;
             }
         }
+        if (auto pid = count_out_pid(constraints))
+        {
+            return *pid;
+        }
+        // Nothing satisfies everything asked for, e.g. an Unown form past Z or ?
+        return pksm::randomNumber(0, 0xFFFFFFFF);
     }
 
     u32 PKX::versionTID() const
@@ -707,6 +862,13 @@ namespace pksm
                  : nullptr;
     }
 
+    std::unique_ptr<PK9> PKX::convertToG9(Sav&) const
+    {
+        return generation() == Generation::NINE
+                 ? std::unique_ptr<PK9>(static_cast<PK9*>(clone().release()))
+                 : nullptr;
+    }
+
     std::unique_ptr<PKX> PKX::partyClone() const
     {
         if (isParty())
@@ -0,0 +1,263 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "pkx/PKXConverter.hpp"
+#include "pkx/PB7.hpp"
+#include "pkx/PK1.hpp"
+#include "pkx/PK2.hpp"
+#include "pkx/PK3.hpp"
+#include "pkx/PK4.hpp"
+#include "pkx/PK5.hpp"
+#include "pkx/PK6.hpp"
+#include "pkx/PK7.hpp"
+#include "pkx/PK8.hpp"
+#include "pkx/PK9.hpp"
+#include "sav/Sav.hpp"
+#include <algorithm>
+#include <functional>
+
+#ifndef _PKSMCORE_CONFIGURED
+#include "PKSMCORE_CONFIG.h"
+#endif
+
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+#include <thread>
+#endif
+
+namespace
+{
+    // Don't bother splitting across threads unless each one gets at least this many Pokemon
+    constexpr size_t CONVERSIONS_PER_THREAD = 32;
+
+    void convertRange(std::span<const pksm::PKX* const> pks,
+        std::span<std::unique_ptr<pksm::PKX>> out, pksm::Generation target, pksm::Sav& save)
+    {
+        pksm::PKXConverter converter;
+        for (size_t i = 0; i < pks.size(); i++)
+        {
+            if (pks[i])
+            {
+                out[i] = converter.convert(*pks[i], target, save);
+            }
+        }
+    }
+}
+
+namespace pksm
+{
+    PKXConverter::PKXConverter()
+        : pk3(PKX::getPKM<Generation::THREE>(nullptr, PK3::BOX_LENGTH)),
+          pk4(PKX::getPKM<Generation::FOUR>(nullptr, PK4::BOX_LENGTH)),
+          pk5(PKX::getPKM<Generation::FIVE>(nullptr, PK5::BOX_LENGTH)),
+          pk6(PKX::getPKM<Generation::SIX>(nullptr, PK6::BOX_LENGTH)),
+          pk7(PKX::getPKM<Generation::SEVEN>(nullptr, PK7::BOX_LENGTH))
+    {
+    }
+
+    PKXConverter::~PKXConverter() = default;
+
+    Generation PKXConverter::nextGeneration(Generation from, Generation target)
+    {
+        switch (from)
+        {
+            // Gen I and II only convert to each other and to Gen VII, which takes them the rest of
+            // the way
+            case Generation::ONE:
+            case Generation::TWO:
+                return target == Generation::ONE || target == Generation::TWO
+                         ? target
+                         : Generation::SEVEN;
+            case Generation::THREE:
+                return target < Generation::THREE ? Generation::TWO : Generation::FOUR;
+            case Generation::FOUR:
+                return target < Generation::FOUR ? Generation::THREE : Generation::FIVE;
+            case Generation::FIVE:
+                return target < Generation::FIVE ? Generation::FOUR : Generation::SIX;
+            case Generation::SIX:
+                return target < Generation::SIX ? Generation::FIVE : Generation::SEVEN;
+            case Generation::SEVEN:
+                return target < Generation::SEVEN ? Generation::SIX : Generation::EIGHT;
+            default:
+                return target;
+        }
+    }
+
+    const PKX* PKXConverter::step(const PKX& pk, Generation next, Sav& save)
+    {
+        bool converted = false;
+        const PKX* ret = nullptr;
+        switch (next)
+        {
+            case Generation::TWO:
+                if (pk.generation() == Generation::THREE)
+                {
+                    pk2       = static_cast<const PK3&>(pk).convertToG2(save);
+                    converted = pk2 != nullptr;
+                    ret       = pk2.get();
+                }
+                break;
+            case Generation::THREE:
+                if (pk.generation() == Generation::FOUR)
+                {
+                    converted = static_cast<const PK4&>(pk).convertToG3(*pk3, save);
+                    ret       = pk3.get();
+                }
+                break;
+            case Generation::FOUR:
+                if (pk.generation() == Generation::THREE)
+                {
+                    converted = static_cast<const PK3&>(pk).convertToG4(*pk4, save);
+                }
+                else if (pk.generation() == Generation::FIVE)
+                {
+                    converted = static_cast<const PK5&>(pk).convertToG4(*pk4, save);
+                }
+                ret = pk4.get();
+                break;
+            case Generation::FIVE:
+                if (pk.generation() == Generation::FOUR)
+                {
+                    converted = static_cast<const PK4&>(pk).convertToG5(*pk5, save);
+                }
+                else if (pk.generation() == Generation::SIX)
+                {
+                    converted = static_cast<const PK6&>(pk).convertToG5(*pk5, save);
+                }
+                ret = pk5.get();
+                break;
+            case Generation::SIX:
+                if (pk.generation() == Generation::FIVE)
+                {
+                    converted = static_cast<const PK5&>(pk).convertToG6(*pk6, save);
+                }
+                else if (pk.generation() == Generation::SEVEN)
+                {
+                    converted = static_cast<const PK7&>(pk).convertToG6(*pk6, save);
+                }
+                ret = pk6.get();
+                break;
+            case Generation::SEVEN:
+                if (pk.generation() == Generation::ONE)
+                {
+                    converted = static_cast<const PK1&>(pk).convertToG7(*pk7, save);
+                }
+                else if (pk.generation() == Generation::TWO)
+                {
+                    converted = static_cast<const PK2&>(pk).convertToG7(*pk7, save);
+                }
+                else if (pk.generation() == Generation::SIX)
+                {
+                    converted = static_cast<const PK6&>(pk).convertToG7(*pk7, save);
+                }
+                ret = pk7.get();
+                break;
+            default:
+                break;
+        }
+        return converted ? ret : nullptr;
+    }
+
+    std::unique_ptr<PKX> PKXConverter::convert(const PKX& pk, Generation target, Sav& save)
+    {
+        const PKX* current = &pk;
+        // Nothing converts to LGPE or IX, so there's no route to walk; walking one anyway could
+        // draw random numbers the convertToG* call wouldn't have
+        if (target != Generation::LGPE && target <= Generation::EIGHT)
+        {
+            Generation next = nextGeneration(current->generation(), target);
+            while (current->generation() != target && next != target)
+            {
+                current = step(*current, next, save);
+                if (!current)
+                {
+                    return nullptr;
+                }
+                next = nextGeneration(current->generation(), target);
+            }
+        }
+
+        // The last step needs a Pokemon of its own to hand back
+        switch (target)
+        {
+            case Generation::ONE:
+                return current->convertToG1(save);
+            case Generation::TWO:
+                return current->convertToG2(save);
+            case Generation::THREE:
+                return current->convertToG3(save);
+            case Generation::FOUR:
+                return current->convertToG4(save);
+            case Generation::FIVE:
+                return current->convertToG5(save);
+            case Generation::SIX:
+                return current->convertToG6(save);
+            case Generation::SEVEN:
+                return current->convertToG7(save);
+            case Generation::LGPE:
+                return current->convertToLGPE(save);
+            case Generation::EIGHT:
+                return current->convertToG8(save);
+            case Generation::NINE:
+                return current->convertToG9(save);
+            default:
+                return nullptr;
+        }
+    }
+
+    std::vector<std::unique_ptr<PKX>> PKXConverter::convert(
+        std::span<const PKX* const> pks, Generation target, Sav& save)
+    {
+        std::vector<std::unique_ptr<PKX>> ret(pks.size());
+
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+        convertRange(pks, ret, target, save);
+#else
+        size_t threads = std::min<size_t>(
+            std::max(std::thread::hardware_concurrency(), 1u), pks.size() / CONVERSIONS_PER_THREAD);
+        if (threads <= 1)
+        {
+            convertRange(pks, ret, target, save);
+            return ret;
+        }
+
+        size_t chunk = pks.size() / threads;
+        std::vector<std::thread> pool;
+        for (size_t i = 1; i < threads; i++)
+        {
+            size_t end = i == threads - 1 ? pks.size() : (i + 1) * chunk;
+            pool.emplace_back(convertRange, pks.subspan(i * chunk, end - i * chunk),
+                std::span{ret}.subspan(i * chunk, end - i * chunk), target, std::ref(save));
+        }
+        convertRange(pks.first(chunk), std::span{ret}.first(chunk), target, save);
+        for (auto& thread : pool)
+        {
+            thread.join();
+        }
+#endif
+
+        return ret;
+    }
+}
@@ -34,7 +34,9 @@
 #include "pkx/PK6.hpp"
 #include "pkx/PK7.hpp"
 #include "pkx/PK8.hpp"
+#include "pkx/PK9.hpp"
 #include "pkx/PKX.hpp"
+#include "pkx/PKXConverter.hpp"
 #include "sav/Sav1.hpp"
 #include "sav/Sav2.hpp"
 #include "sav/SavB2W2.hpp"
@@ -54,7 +56,24 @@
 #include "sav/SavXY.hpp"
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
+#include "utils/io.hpp"
 #include "utils/ValueConverter.hpp"
+#include <algorithm>
+#include <bit>
+
+#ifndef _PKSMCORE_CONFIGURED
+#include "PKSMCORE_CONFIG.h"
+#endif
+
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+#include <thread>
+#endif
+
+namespace
+{
+    // Don't bother splitting transfer checks across threads unless each gets at least this many
+    constexpr size_t CHECKS_PER_THREAD = 1024;
+}
 
 namespace pksm
 {
@@ -102,120 +121,331 @@ namespace pksm
         }
     }
 
-    std::unique_ptr<Sav> Sav::checkGBType(const std::shared_ptr<u8[]>& dt, size_t length)
+    std::unique_ptr<Sav> Sav::getSave(const std::string& path)
     {
-        std::tuple<GameVersion, Language, bool> versionAndLanguage = Sav2::getVersion(dt);
-
-        if (get<2>(versionAndLanguage))
+        size_t length            = 0;
+        std::shared_ptr<u8[]> dt = io::mapFile(path, length);
+        if (!dt)
         {
-            return std::make_unique<Sav2>(dt, length, versionAndLanguage);
+            return nullptr;
         }
+        return getSave(dt, length);
+    }
 
-        switch (Sav1::getVersion(dt))
-        {
-            case Game::RGB:
-                return std::make_unique<Sav1>(dt, length);
-            case Game::Y:
-                return std::make_unique<Sav1>(dt, length); // in case anyone wants to
-            default:
-                return std::unique_ptr<Sav>(nullptr);
-        }
+    void Sav::trackChecksumBlocks(std::span<const u32> blockOffsets)
+    {
+        checksumBlocks = blockOffsets;
+        markAllDirty();
     }
 
-    std::unique_ptr<Sav> Sav::checkGBAType(const std::shared_ptr<u8[]>& dt)
+    void Sav::markDirty(size_t offset, size_t size)
     {
-        switch (Sav3::getVersion(dt))
+        if (checksumBlocks.empty() || size == 0)
         {
-            case Game::RS:
-                return std::make_unique<SavRS>(dt);
-            case Game::E:
-                return std::make_unique<SavE>(dt);
-            case Game::FRLG:
-                return std::make_unique<SavFRLG>(dt);
-            default:
-                return std::unique_ptr<Sav>(nullptr);
+            return;
+        }
+        // Anything before the first block or in a gap between blocks is attributed to the block
+        // before it, which at worst costs one unnecessary checksum
+        auto first = std::upper_bound(checksumBlocks.begin(), checksumBlocks.end(), offset);
+        auto last  = std::upper_bound(first, checksumBlocks.end(), offset + size - 1);
+        for (auto i = first == checksumBlocks.begin() ? first : first - 1; i != last; i++)
+        {
+            dirtyBlocks[i - checksumBlocks.begin()] = true;
         }
     }
 
-    bool Sav::isValidDSSave(const std::shared_ptr<u8[]>& dt)
+    bool Sav::blockDirty(size_t block) const
     {
-        u16 chk1    = LittleEndian::convertTo<u16>(&dt[0x24000 - 0x100 + 0x8C + 0xE]);
-        u16 actual1 = pksm::crypto::ccitt16({&dt[0x24000 - 0x100], 0x8C});
-        if (chk1 == actual1)
+        return block >= dirtyBlocks.size() || dirtyBlocks[block];
+    }
+
+    bool Sav::allBlocksDirty() const
+    {
+        return std::ranges::all_of(dirtyBlocks, [](bool dirty) { return dirty; });
+    }
+
+    void Sav::clearDirty()
+    {
+        std::ranges::fill(dirtyBlocks, false);
+    }
+
+    void Sav::markAllDirty()
+    {
+        dirtyBlocks.assign(checksumBlocks.size(), true);
+        boxesRewritten();
+    }
+
+    void Sav::boxSlotWritten(const PKX& pk, u8 box, u8 slot)
+    {
+        if (slotIndex)
         {
-            return true;
+            slotIndex->set(box, slot, SlotIndex::Key::of(pk));
         }
-        u16 chk2    = LittleEndian::convertTo<u16>(&dt[0x26000 - 0x100 + 0x94 + 0xE]);
-        u16 actual2 = pksm::crypto::ccitt16({&dt[0x26000 - 0x100], 0x94});
-        if (chk2 == actual2)
+        if (!emptySlotBits.empty())
         {
-            return true;
+            int index = box * slotsPerBox() + slot;
+            u64 bit   = u64(1) << (index % 64);
+            if (pk.species() == Species::None)
+            {
+                emptySlotBits[index / 64] |= bit;
+            }
+            else
+            {
+                emptySlotBits[index / 64] &= ~bit;
+            }
         }
+    }
 
-        // Check for block identifiers
-        static constexpr size_t DP_OFFSET   = 0xC100;
-        static constexpr size_t PT_OFFSET   = 0xCF2C;
-        static constexpr size_t HGSS_OFFSET = 0xF628;
-        if (validSequence(dt, DP_OFFSET))
+    void Sav::boxesRewritten()
+    {
+        if (slotIndex)
         {
-            return true;
+            buildSlotIndex();
         }
-        if (validSequence(dt, PT_OFFSET))
+        if (!emptySlotBits.empty())
         {
-            return true;
+            buildEmptySlotBits();
         }
-        if (validSequence(dt, HGSS_OFFSET))
+    }
+
+    int Sav::slotsPerBox() const
+    {
+        // Rounded up for LGPE, whose 1000 slots don't fill its last box
+        return (maxSlot() + maxBoxes() - 1) / maxBoxes();
+    }
+
+    void Sav::buildEmptySlotBits() const
+    {
+        emptySlotBits.assign((maxSlot() + 63) / 64, 0);
+        auto markEmpty = [this](int index)
+        { emptySlotBits[index / 64] |= u64(1) << (index % 64); };
+
+        const int perBox = slotsPerBox();
+        bool viewed      = forEachSlotView(
+            [&](u8 box, u8 slot, auto view)
+            {
+                if (view.species() == Species::None)
+                {
+                    markEmpty(box * perBox + slot);
+                }
+            });
+
+        // Gen I and II Pokemon have no view
+        if (!viewed)
         {
-            return true;
+            for (int i = 0; i < maxSlot(); i++)
+            {
+                auto boxed = pkm(i / perBox, i % perBox);
+                if (!boxed || boxed->species() == Species::None)
+                {
+                    markEmpty(i);
+                }
+            }
         }
+    }
 
-        // Check the other save
-        if (validSequence(dt, DP_OFFSET + 0x40000))
+    int Sav::nextFreeSlot(int after) const
+    {
+        if (emptySlotBits.empty())
         {
-            return true;
+            buildEmptySlotBits();
         }
-        if (validSequence(dt, PT_OFFSET + 0x40000))
+
+        int start = std::max(after + 1, 0);
+        if (start >= maxSlot())
         {
-            return true;
+            return -1;
         }
-        if (validSequence(dt, HGSS_OFFSET + 0x40000))
+        // Bits past maxSlot() are never set, so the first set bit found is always a real slot
+        size_t word = start / 64;
+        u64 bits    = emptySlotBits[word] & (~u64(0) << (start % 64));
+        while (bits == 0)
         {
-            return true;
+            if (++word == emptySlotBits.size())
+            {
+                return -1;
+            }
+            bits = emptySlotBits[word];
         }
-        return false;
+        return word * 64 + std::countr_zero(bits);
     }
 
-    std::unique_ptr<Sav> Sav::checkDSType(const std::shared_ptr<u8[]>& dt)
+    int Sav::freeSlotCount() const
     {
-        // Check for block identifiers
-        static constexpr size_t DP_OFFSET   = 0xC100;
-        static constexpr size_t PT_OFFSET   = 0xCF2C;
-        static constexpr size_t HGSS_OFFSET = 0xF628;
-        if (validSequence(dt, DP_OFFSET))
+        if (emptySlotBits.empty())
         {
-            return std::make_unique<SavDP>(dt);
+            buildEmptySlotBits();
         }
-        if (validSequence(dt, PT_OFFSET))
+
+        int ret = 0;
+        for (u64 bits : emptySlotBits)
         {
-            return std::make_unique<SavPT>(dt);
+            ret += std::popcount(bits);
         }
-        if (validSequence(dt, HGSS_OFFSET))
+        return ret;
+    }
+
+    void Sav::buildSlotIndex()
+    {
+        slotIndex   = std::make_unique<SlotIndex>();
+        bool viewed = forEachSlotView([this](u8 box, u8 slot, auto view)
+            { slotIndex->set(box, slot, SlotIndex::Key::of(view)); });
+
+        // Gen I and II Pokemon have no view
+        if (!viewed)
         {
-            return std::make_unique<SavHGSS>(dt);
+            const int perBox = slotsPerBox();
+            for (int i = 0; i < maxSlot(); i++)
+            {
+                auto boxed = pkm(i / perBox, i % perBox);
+                if (boxed)
+                {
+                    slotIndex->set(i / perBox, i % perBox, SlotIndex::Key::of(*boxed));
+                }
+            }
         }
+    }
+
+    std::span<const SlotIndex::Slot> Sav::slotsWithSpecies(Species species, u16 form) const
+    {
+        return slotIndex ? slotIndex->species(species, form) : std::span<const SlotIndex::Slot>{};
+    }
+
+    std::span<const SlotIndex::Slot> Sav::slotsWithShiny() const
+    {
+        return slotIndex ? slotIndex->shiny() : std::span<const SlotIndex::Slot>{};
+    }
+
+    std::span<const SlotIndex::Slot> Sav::slotsWithTSV(u16 tsv) const
+    {
+        return slotIndex ? slotIndex->TSV(tsv) : std::span<const SlotIndex::Slot>{};
+    }
+
+    std::span<const SlotIndex::Slot> Sav::slotsWithBall(Ball ball) const
+    {
+        return slotIndex ? slotIndex->ball(ball) : std::span<const SlotIndex::Slot>{};
+    }
+
+    std::span<const SlotIndex::Slot> Sav::slotsWithHeldItem(u16 item) const
+    {
+        return slotIndex ? slotIndex->heldItem(item) : std::span<const SlotIndex::Slot>{};
+    }
 
-        // Check the other save
-        if (validSequence(dt, DP_OFFSET + 0x40000))
+    bool Sav::exportSnapshot(std::span<u8> out)
+    {
+        if (out.size() < length)
         {
-            return std::make_unique<SavDP>(dt);
+            return false;
         }
-        if (validSequence(dt, PT_OFFSET + 0x40000))
+        finishEditing();
+        std::copy(data.get(), data.get() + length, out.begin());
+        beginEditing();
+        return true;
+    }
+
+    bool Sav::writeToFile(const std::string& path) const
+    {
+        return io::writeFile(path, {data.get(), length});
+    }
+
+    std::optional<Sav::SaveInfo> Sav::identify(std::span<const u8> dt)
+    {
+        switch (dt.size())
         {
-            return std::make_unique<SavPT>(dt);
+            case 0x6CC00:
+                return SaveInfo{Game::USUM, Generation::SEVEN, Language(dt[0x1400 + 0x35]), -1,
+                    Confidence::Size};
+            case 0x6BE00:
+                return SaveInfo{Game::SM, Generation::SEVEN, Language(dt[0x1200 + 0x35]), -1,
+                    Confidence::Size};
+            case 0x76000:
+                return SaveInfo{Game::ORAS, Generation::SIX, Language(dt[0x14000 + 0x2D]), -1,
+                    Confidence::Size};
+            case 0x65600:
+                return SaveInfo{Game::XY, Generation::SIX, Language(dt[0x14000 + 0x2D]), -1,
+                    Confidence::Size};
+            case 0x80000:
+                return identifyDS(dt);
+            case 0x20000:
+            {
+                auto [partition, blockOfs0] = Sav3::getActiveBlock0(dt);
+                bool japanese = LittleEndian::convertTo<s16>(&dt[blockOfs0 + 0x6]) == 0;
+                return SaveInfo{Sav3::getVersion(dt, blockOfs0), Generation::THREE,
+                    japanese ? Language::JPN : Language::ENG, partition, Confidence::Structure};
+            }
+            case 0x8000:
+            case 0x10000:
+            // Gen II VC saves
+            case 0x8010:
+            case 0x10010:
+            // Emulator standard saves
+            case 0x8030:
+            case 0x10030:
+            {
+                auto [version, language, found] = Sav2::getVersion(dt);
+                if (found)
+                {
+                    return SaveInfo{version == GameVersion::C ? Game::C : Game::GS,
+                        Generation::TWO, language, -1, Confidence::Structure};
+                }
+                // Same two box checks Sav1 uses; international saves need their OT name decoded
+                bool japanese = ((dt[0x2ED5] <= 30) && (dt[0x2ED5 + 1 + dt[0x2ED5]] == 0xFF)) &&
+                                ((dt[0x302D] <= 30) && (dt[0x302D + 1 + dt[0x302D]] == 0xFF));
+                return SaveInfo{Sav1::getVersion(dt), Generation::ONE,
+                    japanese ? Language::JPN : Language::None, -1,
+                    japanese ? Confidence::Structure : Confidence::Size};
+            }
+            case 0xB8800:
+            case 0x100000:
+                return SaveInfo{Game::LGPE, Generation::LGPE, Language(dt[0x1035]), -1,
+                    Confidence::Size};
+            case SavSWSH::SIZE_G8SWSH:
+            case SavSWSH::SIZE_G8SWSH_1:
+            case SavSWSH::SIZE_G8SWSH_2:
+            case SavSWSH::SIZE_G8SWSH_2B:
+            case SavSWSH::SIZE_G8SWSH_3:
+            case SavSWSH::SIZE_G8SWSH_3A:
+            case SavSWSH::SIZE_G8SWSH_3B:
+            case SavSWSH::SIZE_G8SWSH_3C:
+                return SaveInfo{
+                    Game::SWSH, Generation::EIGHT, Language::None, -1, Confidence::Size};
+            case 0x319DC3:
+                return SaveInfo{Game::SV, Generation::NINE, Language::None, -1, Confidence::Size};
+            default:
+                return std::nullopt;
         }
-        if (validSequence(dt, HGSS_OFFSET + 0x40000))
+    }
+
+    std::optional<Sav::SaveInfo> Sav::identifyDS(std::span<const u8> dt)
+    {
+        struct Gen4Layout
         {
-            return std::make_unique<SavHGSS>(dt);
+            Game game;
+            size_t blockOffset;
+            int counterOffset;
+            int trainer1;
+        };
+
+        // Check for block identifiers
+        static constexpr std::array<Gen4Layout, 3> GEN4_LAYOUTS = {
+            Gen4Layout{Game::DP,   0xC100, 0xC0EC, 0x64},
+            Gen4Layout{Game::Pt,   0xCF2C, 0xCF18, 0x68},
+            Gen4Layout{Game::HGSS, 0xF628, 0xF614, 0x64}
+        };
+
+        // Check the other save after the first one
+        for (size_t partitionOffset : {0, 0x40000})
+        {
+            for (const auto& layout : GEN4_LAYOUTS)
+            {
+                if (validSequence(dt, layout.blockOffset + partitionOffset))
+                {
+                    int partition = Sav4::activePartition(dt, layout.counterOffset);
+                    return SaveInfo{layout.game, Generation::FOUR,
+                        Language(dt[layout.trainer1 + partition * 0x40000 + 0x19]), partition,
+                        Confidence::Structure};
+                }
+            }
         }
 
         // Check for BW/B2W2 checksums
@@ -223,18 +453,85 @@ namespace pksm
         u16 actual1 = pksm::crypto::ccitt16({&dt[0x24000 - 0x100], 0x8C});
         if (chk1 == actual1)
         {
-            return std::make_unique<SavBW>(dt);
+            return SaveInfo{Game::BW, Generation::FIVE, Language(dt[0x19400 + 0x1E]), -1,
+                Confidence::Checksum};
         }
         u16 chk2    = LittleEndian::convertTo<u16>(&dt[0x26000 - 0x100 + 0x94 + 0xE]);
         u16 actual2 = pksm::crypto::ccitt16({&dt[0x26000 - 0x100], 0x94});
         if (chk2 == actual2)
         {
-            return std::make_unique<SavB2W2>(dt);
+            return SaveInfo{Game::B2W2, Generation::FIVE, Language(dt[0x19400 + 0x1E]), -1,
+                Confidence::Checksum};
         }
-        return nullptr;
+        return std::nullopt;
     }
 
-    bool Sav::validSequence(const std::shared_ptr<u8[]>& dt, size_t offset)
+    std::unique_ptr<Sav> Sav::checkGBType(const std::shared_ptr<u8[]>& dt, size_t length)
+    {
+        std::tuple<GameVersion, Language, bool> versionAndLanguage =
+            Sav2::getVersion({dt.get(), length});
+
+        if (get<2>(versionAndLanguage))
+        {
+            return std::make_unique<Sav2>(dt, length, versionAndLanguage);
+        }
+
+        switch (Sav1::getVersion({dt.get(), length}))
+        {
+            case Game::RGB:
+                return std::make_unique<Sav1>(dt, length);
+            case Game::Y:
+                return std::make_unique<Sav1>(dt, length); // in case anyone wants to
+            default:
+                return std::unique_ptr<Sav>(nullptr);
+        }
+    }
+
+    std::unique_ptr<Sav> Sav::checkGBAType(const std::shared_ptr<u8[]>& dt)
+    {
+        switch (Sav3::getVersion({dt.get(), 0x20000}))
+        {
+            case Game::RS:
+                return std::make_unique<SavRS>(dt);
+            case Game::E:
+                return std::make_unique<SavE>(dt);
+            case Game::FRLG:
+                return std::make_unique<SavFRLG>(dt);
+            default:
+                return std::unique_ptr<Sav>(nullptr);
+        }
+    }
+
+    bool Sav::isValidDSSave(const std::shared_ptr<u8[]>& dt)
+    {
+        return identifyDS({dt.get(), 0x80000}).has_value();
+    }
+
+    std::unique_ptr<Sav> Sav::checkDSType(const std::shared_ptr<u8[]>& dt)
+    {
+        auto info = identifyDS({dt.get(), 0x80000});
+        if (!info)
+        {
+            return nullptr;
+        }
+        switch (info->game)
+        {
+            case Game::DP:
+                return std::make_unique<SavDP>(dt);
+            case Game::Pt:
+                return std::make_unique<SavPT>(dt);
+            case Game::HGSS:
+                return std::make_unique<SavHGSS>(dt);
+            case Game::BW:
+                return std::make_unique<SavBW>(dt);
+            case Game::B2W2:
+                return std::make_unique<SavB2W2>(dt);
+            default:
+                return nullptr;
+        }
+    }
+
+    bool Sav::validSequence(std::span<const u8> dt, size_t offset)
     {
         static constexpr u32 DATE_INTERNATIONAL = 0x20060623;
         static constexpr u32 DATE_KOREAN        = 0x20070903;
@@ -270,12 +567,120 @@ namespace pksm
                 return pk.convertToLGPE(*this);
             case Generation::EIGHT:
                 return pk.convertToG8(*this);
+            case Generation::NINE:
+                return pk.convertToG9(*this);
             case Generation::UNUSED:
                 return nullptr;
         }
         return nullptr;
     }
 
+    std::vector<Sav::BadTransferReason> Sav::transferAll(
+        std::span<const PKX* const> pks, bool applyTrade)
+    {
+        std::vector<BadTransferReason> ret = invalidTransferReasons(pks);
+
+        std::vector<size_t> order;
+        order.reserve(pks.size());
+        for (size_t i = 0; i < pks.size(); i++)
+        {
+            if (!pks[i])
+            {
+                ret[i] = BadTransferReason::CONVERSION;
+            }
+            else if (ret[i] == BadTransferReason::OKAY)
+            {
+                order.emplace_back(i);
+            }
+        }
+        if (order.empty())
+        {
+            return ret;
+        }
+
+        // Grouped by source generation, so that the Pokemon each thread converts mostly take the
+        // same route
+        std::ranges::stable_sort(order, [&pks](size_t a, size_t b)
+            { return pks[a]->generation() < pks[b]->generation(); });
+        std::vector<const PKX*> grouped(order.size());
+        std::ranges::transform(order, grouped.begin(), [&pks](size_t i) { return pks[i]; });
+        auto converted = PKXConverter::convert(grouped, generation(), *this);
+
+        std::vector<std::unique_ptr<PKX>> results(pks.size());
+        for (size_t i = 0; i < order.size(); i++)
+        {
+            results[order[i]] = std::move(converted[i]);
+        }
+
+        const int perBox = slotsPerBox();
+        int freeSlot     = firstFreeSlot();
+        for (size_t i = 0; i < pks.size(); i++)
+        {
+            if (ret[i] != BadTransferReason::OKAY)
+            {
+                continue;
+            }
+            if (!results[i])
+            {
+                ret[i] = BadTransferReason::CONVERSION;
+            }
+            else if (freeSlot < 0)
+            {
+                ret[i] = BadTransferReason::SPACE;
+            }
+            else
+            {
+                pkm(*results[i], freeSlot / perBox, freeSlot % perBox, applyTrade);
+                freeSlot = nextFreeSlot(freeSlot);
+            }
+        }
+
+        return ret;
+    }
+
+    bool Sav::pkmInto(PKX& out, u8 slot) const
+    {
+        auto pk = pkm(slot);
+        if (!pk || pk->generation() != out.generation() || pk->getLength() != out.getLength())
+        {
+            return false;
+        }
+        out = *pk;
+        return true;
+    }
+
+    bool Sav::pkmInto(PKX& out, u8 box, u8 slot) const
+    {
+        auto pk = pkm(box, slot);
+        if (!pk || pk->generation() != out.generation() || pk->getLength() != out.getLength())
+        {
+            return false;
+        }
+        out = *pk;
+        return true;
+    }
+
+    bool Sav::visitBoxSlots(SlotVisitor, void*) const
+    {
+        return false;
+    }
+
+    void Sav::visitBoxSlot(
+        SlotVisitor visitor, void* context, u8 box, u8 slot, const u8* entry, size_t length) const
+    {
+        if (crypto::pkm::isEncrypted(generation(), entry))
+        {
+            alignas(u32) u8 buffer[PKXView<Generation::NINE>::SLOT_LENGTH];
+            std::copy(entry, entry + length, buffer);
+            crypto::pkm::cryptBoxData(generation(), {buffer, length}, length, true);
+            visitor(context, box, slot, buffer);
+        }
+        else
+        {
+            visitor(context, box, slot, entry);
+        }
+    }
+
     void Sav::fixParty()
     {
         // Poor man's bubble sort-like thing
@@ -343,16 +748,70 @@ namespace pksm
     }
 
     Sav::BadTransferReason Sav::invalidTransferReason(const PKX& pk) const
+    {
+        return invalidTransferReason(
+            pk, version(), generation(), VersionTables::legalityBits(version()));
+    }
+
+    std::vector<Sav::BadTransferReason> Sav::invalidTransferReasons(
+        std::span<const PKX* const> pks) const
+    {
+        std::vector<BadTransferReason> ret(pks.size(), BadTransferReason::OKAY);
+        const GameVersion version               = this->version();
+        const Generation generation             = this->generation();
+        const VersionTables::LegalityBits& bits = VersionTables::legalityBits(version);
+
+        auto checkRange = [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; i++)
+            {
+                if (pks[i])
+                {
+                    ret[i] = invalidTransferReason(*pks[i], version, generation, bits);
+                }
+            }
+        };
+
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+        checkRange(0, pks.size());
+#else
+        size_t threads = std::min<size_t>(
+            std::max(std::thread::hardware_concurrency(), 1u), pks.size() / CHECKS_PER_THREAD);
+        if (threads <= 1)
+        {
+            checkRange(0, pks.size());
+            return ret;
+        }
+
+        size_t chunk = pks.size() / threads;
+        std::vector<std::thread> pool;
+        for (size_t i = 1; i < threads; i++)
+        {
+            pool.emplace_back(
+                checkRange, i * chunk, i == threads - 1 ? pks.size() : (i + 1) * chunk);
+        }
+        checkRange(0, chunk);
+        for (auto& thread : pool)
+        {
+            thread.join();
+        }
+#endif
+
+        return ret;
+    }
+
+    Sav::BadTransferReason Sav::invalidTransferReason(const PKX& pk, GameVersion version,
+        Generation generation, const VersionTables::LegalityBits& bits)
     {
         bool moveBad = false;
         for (int i = 0; i < 4; i++)
         {
-            if (availableMoves().count(pk.move(i)) == 0)
+            if (!bits.hasMove(pk.move(i)))
             {
                 moveBad = true;
                 break;
             }
-            if (availableMoves().count(pk.relearnMove(i)) == 0)
+            if (!bits.hasMove(pk.relearnMove(i)))
             {
                 moveBad = true;
                 break;
@@ -362,27 +821,27 @@ namespace pksm
         {
             return BadTransferReason::MOVE;
         }
-        if (availableSpecies().count(pk.species()) == 0)
+        if (!bits.hasSpecies(pk.species()))
         {
             return BadTransferReason::SPECIES;
         }
-        if (pk.alternativeForm() >= formCount(pk.species()) &&
+        if (pk.alternativeForm() >= VersionTables::formCount(version, pk.species()) &&
             !((pk.species() == Species::Scatterbug || pk.species() == Species::Spewpa) &&
-                pk.alternativeForm() < formCount(Species::Vivillon)) &&
+                pk.alternativeForm() < VersionTables::formCount(version, Species::Vivillon)) &&
             !((pk.species() == Species::Mothim) &&
-                pk.alternativeForm() < formCount(Species::Burmy)))
+                pk.alternativeForm() < VersionTables::formCount(version, Species::Burmy)))
         {
             return BadTransferReason::FORM;
         }
-        if (availableAbilities().count(pk.ability()) == 0)
+        if (!bits.hasAbility(pk.ability()))
         {
-            if (generation() > Generation::TWO && pk.generation() > Generation::TWO)
+            if (generation > Generation::TWO && pk.generation() > Generation::TWO)
             {
                 return BadTransferReason::ABILITY;
             }
         }
 
-        if (generation() <= Generation::TWO)
+        if (generation <= Generation::TWO)
         {
             const int heldItem2 = pk.generation() == Generation::ONE
                                     ? (int)static_cast<const PK1&>(pk).heldItem2()
@@ -390,32 +849,32 @@ namespace pksm
                                               ? (int)static_cast<const PK2&>(pk).heldItem2()
                                               : (int)ItemConverter::nationalToG2(pk.heldItem()));
             // Crystal only adds key items
-            if (VersionTables::availableItems(GameVersion::GD).count(heldItem2) == 0 ||
+            if (!VersionTables::legalityBits(GameVersion::GD).hasItem(heldItem2) ||
                 (heldItem2 == 0 && pk.heldItem() != 0))
             {
                 return BadTransferReason::ITEM;
             }
         }
-        else if (generation() == Generation::THREE)
+        else if (generation == Generation::THREE)
         {
             const int heldItem3 = pk.generation() == Generation::THREE
                                     ? (int)static_cast<const PK3&>(pk).heldItem3()
                                     : (int)ItemConverter::nationalToG3(pk.heldItem());
-            if (availableItems().count(heldItem3) == 0 || (heldItem3 == 0 && pk.heldItem() != 0))
+            if (!bits.hasItem(heldItem3) || (heldItem3 == 0 && pk.heldItem() != 0))
             {
                 return BadTransferReason::ITEM;
             }
         }
-        else if (availableItems().count((int)pk.heldItem()) == 0 ||
+        else if (!bits.hasItem(pk.heldItem()) ||
                  (pk.generation() == Generation::THREE &&
                      pk.heldItem() == ItemConverter::ITEM_NOT_CONVERTIBLE))
         {
             return BadTransferReason::ITEM;
         }
 
-        if (availableBalls().count(pk.ball()) == 0)
+        if (!bits.hasBall(pk.ball()))
         {
-            if (generation() > Generation::TWO)
+            if (generation > Generation::TWO)
             {
                 return BadTransferReason::BALL;
             }
@@ -71,7 +71,7 @@ namespace pksm
         originalCurrentBox = currentBox();
     }
 
-    Sav::Game Sav1::getVersion(const std::shared_ptr<u8[]>& dt)
+    Sav::Game Sav1::getVersion(std::span<const u8>)
     {
         // for now it doesn't matter, the only difference is Pikachu's friendship and Pikachu surf
         // score
@@ -464,6 +464,8 @@ namespace pksm
                     pk1->rawData().subspan(3 + PK1::PARTY_LENGTH + nameLength(), nameLength()),
                     &data[boxNicknameOffset(box, slot)]);
             }
+
+            boxSlotWritten(*pk1, box, slot);
         }
     }
 
@@ -474,7 +476,7 @@ namespace pksm
 
     void Sav1::dex(const PKX& pk)
     {
-        if (!(availableSpecies().count(pk.species()) > 0))
+        if (!legalityBits().hasSpecies(pk.species()))
         {
             return;
         }
@@ -512,13 +514,13 @@ namespace pksm
 
     int Sav1::dexSeen() const
     {
-        return std::count_if(availableSpecies().begin(), availableSpecies().end(),
+        return std::ranges::count_if(speciesList(),
             [this](const auto& spec) { return getSeen(spec); });
     }
 
     int Sav1::dexCaught() const
     {
-        return std::count_if(availableSpecies().begin(), availableSpecies().end(),
+        return std::ranges::count_if(speciesList(),
             [this](const auto& spec) { return getCaught(spec); });
     }
 
@@ -177,7 +177,7 @@ namespace pksm
         }
     }
 
-    std::tuple<GameVersion, Language, bool> Sav2::getVersion(const std::shared_ptr<u8[]>& dt)
+    std::tuple<GameVersion, Language, bool> Sav2::getVersion(std::span<const u8> dt)
     {
         GameVersion returnVersion = GameVersion::INVALID;
         Language returnLanguage   = Language::None;
@@ -221,7 +221,7 @@ namespace pksm
         return {returnVersion, returnLanguage, saveFound};
     }
 
-    bool Sav2::validList(const std::shared_ptr<u8[]>& dt, size_t ofs, u8 slot)
+    bool Sav2::validList(std::span<const u8> dt, size_t ofs, u8 slot)
     {
         return (dt[ofs] <= 30) && (dt[ofs + 1 + dt[ofs]] == 0xFF);
     }
@@ -673,6 +673,8 @@ namespace pksm
             }
 
             data[boxStart(box) + 1 + slot] = pk2->rawData()[1];
+
+            boxSlotWritten(*pk2, box, slot);
         }
     }
 
@@ -683,7 +685,7 @@ namespace pksm
 
     void Sav2::dex(const PKX& pk)
     {
-        if (!(availableSpecies().count(pk.species()) > 0))
+        if (!legalityBits().hasSpecies(pk.species()))
         {
             return;
         }
@@ -742,13 +744,13 @@ namespace pksm
 
     int Sav2::dexSeen() const
     {
-        return std::count_if(availableSpecies().begin(), availableSpecies().end(),
+        return std::ranges::count_if(speciesList(),
             [this](const auto& spec) { return getSeen(spec); });
     }
 
     int Sav2::dexCaught() const
     {
-        return std::count_if(availableSpecies().begin(), availableSpecies().end(),
+        return std::ranges::count_if(speciesList(),
             [this](const auto& spec) { return getCaught(spec); });
     }
 
@@ -40,10 +40,10 @@ namespace pksm
 {
     void Sav3::loadBlocks()
     {
-        std::array<int, BLOCK_COUNT> o1 = getBlockOrder(data, 0);
+        std::array<int, BLOCK_COUNT> o1 = getBlockOrder({data.get(), length}, 0);
         // I removed a length > 0x10000, since length should always be 0x20000 I think that's fine?
-        std::array<int, BLOCK_COUNT> o2 = getBlockOrder(data, 0xE000);
-        activeSAV                       = getActiveSaveIndex(data, o1, o2);
+        std::array<int, BLOCK_COUNT> o2 = getBlockOrder({data.get(), length}, 0xE000);
+        activeSAV                       = getActiveSaveIndex({data.get(), length}, o1, o2);
         blockOrder                      = activeSAV == 0 ? o1 : o2;
 
         for (int i = 0; i < BLOCK_COUNT; i++)
@@ -55,7 +55,7 @@ namespace pksm
         }
     }
 
-    std::array<int, Sav3::BLOCK_COUNT> Sav3::getBlockOrder(const std::shared_ptr<u8[]>& dt, int ofs)
+    std::array<int, Sav3::BLOCK_COUNT> Sav3::getBlockOrder(std::span<const u8> dt, int ofs)
     {
         std::array<int, BLOCK_COUNT> order;
         for (int i = 0; i < BLOCK_COUNT; i++)
@@ -65,7 +65,7 @@ namespace pksm
         return order;
     }
 
-    int Sav3::getActiveSaveIndex(const std::shared_ptr<u8[]>& dt,
+    int Sav3::getActiveSaveIndex(std::span<const u8> dt,
         std::array<int, BLOCK_COUNT>& blockOrder1, std::array<int, BLOCK_COUNT>& blockOrder2)
     {
         int zeroBlock1 = std::find(blockOrder1.begin(), blockOrder1.end(), 0) - blockOrder1.begin();
@@ -83,9 +83,8 @@ namespace pksm
         return count1 > count2 ? 0 : 1;
     }
 
-    Sav::Game Sav3::getVersion(const std::shared_ptr<u8[]>& dt)
+    std::pair<int, int> Sav3::getActiveBlock0(std::span<const u8> dt)
     {
-        // Get block 0 offset
         std::array<int, BLOCK_COUNT> o1     = getBlockOrder(dt, 0);
         std::array<int, BLOCK_COUNT> o2     = getBlockOrder(dt, BLOCK_COUNT * SIZE_BLOCK);
         int activeSAV                       = getActiveSaveIndex(dt, o1, o2);
@@ -93,9 +92,17 @@ namespace pksm
 
         int ABO = activeSAV * SIZE_BLOCK * BLOCK_COUNT;
 
-        int blockOfs0 =
-            ((std::find(order.begin(), order.end(), 0) - order.begin()) * SIZE_BLOCK) + ABO;
+        return {activeSAV,
+            ((std::find(order.begin(), order.end(), 0) - order.begin()) * SIZE_BLOCK) + ABO};
+    }
 
+    Sav::Game Sav3::getVersion(std::span<const u8> dt)
+    {
+        return getVersion(dt, getActiveBlock0(dt).second);
+    }
+
+    Sav::Game Sav3::getVersion(std::span<const u8> dt, int blockOfs0)
+    {
         // Get version
         u32 gameCode = LittleEndian::convertTo<u32>(&dt[blockOfs0 + 0xAC]);
         switch (gameCode)
@@ -453,6 +460,30 @@ namespace pksm
         }
     }
 
+    bool Sav3::pkmInto(PKX& out, u8 slot) const
+    {
+        return PKX::getPKM<Generation::THREE>(out, &data[partyOffset(slot)], PK3::PARTY_LENGTH);
+    }
+
+    bool Sav3::pkmInto(PKX& out, u8 box, u8 slot) const
+    {
+        u32 offset = boxOffset(box, slot);
+        // Is it split?
+        if ((offset % 0x1000) + PK3::BOX_LENGTH > 0xF80)
+        {
+            // Concatenate the data if so
+            u8 pkmData[PK3::BOX_LENGTH];
+            auto nextOut = std::copy(&data[offset], &data[(offset & 0xFFFFF000) | 0xF80], pkmData);
+            u32 nextOffset = boxOffset(box + (slot + 1) / 30, (slot + 1) % 30);
+            std::copy(&data[nextOffset & 0xFFFFF000], &data[nextOffset], nextOut);
+            return PKX::getPKM<Generation::THREE>(out, pkmData, PK3::BOX_LENGTH);
+        }
+        else
+        {
+            return PKX::getPKM<Generation::THREE>(out, &data[offset], PK3::BOX_LENGTH);
+        }
+    }
+
     void Sav3::pkm(const PKX& pk, u8 slot)
     {
         if (pk.generation() == Generation::THREE)
@@ -473,21 +504,27 @@ namespace pksm
                 trade(*pk3);
             }
 
-            u32 offset = boxOffset(box, slot);
-            // Is it split?
-            if ((offset % 0x1000) + PK3::BOX_LENGTH > 0xF80)
-            {
-                // Copy into the correct positions if so
-                u32 firstSize = 0xF80 - (offset % 0x1000);
-                std::ranges::copy(pk3->rawData().subspan(0, firstSize), &data[offset]);
-                u32 nextOffset = boxOffset(box + (slot + 1) / 30, (slot + 1) % 30);
-                std::ranges::copy(pk3->rawData().subspan(firstSize, PK3::BOX_LENGTH - firstSize),
-                    &data[nextOffset & 0xFFFFF000]);
-            }
-            else
-            {
-                std::ranges::copy(pk3->rawData(), &data[offset]);
-            }
+            boxSlotData(box, slot, pk3->rawData());
+            boxSlotWritten(*pk3, box, slot);
+        }
+    }
+
+    void Sav3::boxSlotData(u8 box, u8 slot, std::span<const u8> pkmData)
+    {
+        u32 offset = boxOffset(box, slot);
+        // Is it split?
+        if ((offset % 0x1000) + PK3::BOX_LENGTH > 0xF80)
+        {
+            // Copy into the correct positions if so
+            u32 firstSize = 0xF80 - (offset % 0x1000);
+            std::ranges::copy(pkmData.subspan(0, firstSize), &data[offset]);
+            u32 nextOffset = boxOffset(box + (slot + 1) / 30, (slot + 1) % 30);
+            std::ranges::copy(pkmData.subspan(firstSize, PK3::BOX_LENGTH - firstSize),
+                &data[nextOffset & 0xFFFFF000]);
+        }
+        else
+        {
+            std::ranges::copy(pkmData.subspan(0, PK3::BOX_LENGTH), &data[offset]);
         }
     }
 
@@ -601,13 +638,13 @@ namespace pksm
 
     int Sav3::dexSeen(void) const
     {
-        return std::count_if(availableSpecies().begin(), availableSpecies().end(),
+        return std::ranges::count_if(speciesList(),
             [this](const auto& spec) { return getSeen(spec); });
     }
 
     int Sav3::dexCaught(void) const
     {
-        return std::count_if(availableSpecies().begin(), availableSpecies().end(),
+        return std::ranges::count_if(speciesList(),
             [this](const auto& spec) { return getCaught(spec); });
     }
 
@@ -618,34 +655,60 @@ namespace pksm
     }
 
     void Sav3::cryptBoxData(bool crypted)
+    {
+        for (int i = 0; i < maxSlot();)
+        {
+            u8 box     = i / 30;
+            u8 slot    = i % 30;
+            u32 offset = boxOffset(box, slot);
+            if ((offset % 0x1000) + PK3::BOX_LENGTH > 0xF80)
+            {
+                // If it's split, it needs to get fully copied out and re-set in
+                std::unique_ptr<PKX> pk3 = pkm(box, slot);
+                if (!crypted)
+                {
+                    pk3->encrypt();
+                }
+                // Written around pkm() so the slot index never sees the encrypted Pokemon
+                boxSlotData(box, slot, pk3->rawData());
+                i++;
+            }
+            else
+            {
+                // Otherwise, everything up to the next split slot is contiguous
+                int count = std::min<int>(
+                    (0xF80 - (offset % 0x1000)) / PK3::BOX_LENGTH, maxSlot() - i);
+                pksm::crypto::pkm::cryptBoxData(Generation::THREE,
+                    {&data[offset], PK3::BOX_LENGTH * count}, PK3::BOX_LENGTH, crypted);
+                i += count;
+            }
+        }
+    }
+
+    bool Sav3::visitBoxSlots(SlotVisitor visitor, void* context) const
     {
         for (u8 box = 0; box < maxBoxes(); box++)
         {
             for (u8 slot = 0; slot < 30; slot++)
             {
                 u32 offset = boxOffset(box, slot);
-                bool split = (offset % 0x1000) + PK3::BOX_LENGTH > 0xF80;
-                // If it's split, it needs to get fully copied out and re-set in
-                // Otherwise, use the direct-modification constructor
-                std::unique_ptr<PKX> pk3;
-                if (split)
+                // Slots split across sectors have to be put back together first
+                if ((offset % 0x1000) + PK3::BOX_LENGTH > 0xF80)
                 {
-                    pk3 = pkm(box, slot);
+                    u8 pkmData[PK3::BOX_LENGTH];
+                    auto nextOut =
+                        std::copy(&data[offset], &data[(offset & 0xFFFFF000) | 0xF80], pkmData);
+                    u32 nextOffset = boxOffset(box + (slot + 1) / 30, (slot + 1) % 30);
+                    std::copy(&data[nextOffset & 0xFFFFF000], &data[nextOffset], nextOut);
+                    visitBoxSlot(visitor, context, box, slot, pkmData, PK3::BOX_LENGTH);
                 }
                 else
                 {
-                    pk3 = PKX::getPKM<Generation::THREE>(&data[offset], PK3::BOX_LENGTH, true);
-                }
-                if (!crypted)
-                {
-                    pk3->encrypt();
-                }
-                if (split)
-                {
-                    pkm(*pk3, box, slot, false);
+                    visitBoxSlot(visitor, context, box, slot, &data[offset], PK3::BOX_LENGTH);
                 }
             }
         }
+        return true;
     }
 
     std::string Sav3::boxName(u8 box) const
@@ -58,68 +58,44 @@ namespace pksm
         }
     }
 
-    void Sav4::GBO(void)
+    int Sav4::activePartition(std::span<const u8> dt, int ofs)
     {
-        int ofs = GBOOffset;
-
-        u32 major1 = LittleEndian::convertTo<u32>(&data[ofs]),
-            major2 = LittleEndian::convertTo<u32>(&data[ofs + 0x40000]),
-            minor1 = LittleEndian::convertTo<u32>(&data[ofs + 4]),
-            minor2 = LittleEndian::convertTo<u32>(&data[ofs + 0x40004]);
+        u32 major1 = LittleEndian::convertTo<u32>(&dt[ofs]),
+            major2 = LittleEndian::convertTo<u32>(&dt[ofs + 0x40000]),
+            minor1 = LittleEndian::convertTo<u32>(&dt[ofs + 4]),
+            minor2 = LittleEndian::convertTo<u32>(&dt[ofs + 0x40004]);
 
         CountType cmp = compareCounters(major1, major2);
         if (cmp == CountType::FIRST)
         {
-            gbo = 0;
+            return 0;
         }
         else if (cmp == CountType::SECOND)
         {
-            gbo = 0x40000;
+            return 1;
         }
         else
         {
             cmp = compareCounters(minor1, minor2);
             if (cmp == CountType::SECOND)
             {
-                gbo = 0x40000;
+                return 1;
             }
             else
             {
-                gbo = 0;
+                return 0;
             }
         }
     }
 
-    void Sav4::SBO(void)
+    void Sav4::GBO(void)
     {
-        int ofs = SBOOffset;
-
-        u32 major1 = LittleEndian::convertTo<u32>(&data[ofs]),
-            major2 = LittleEndian::convertTo<u32>(&data[ofs + 0x40000]),
-            minor1 = LittleEndian::convertTo<u32>(&data[ofs + 4]),
-            minor2 = LittleEndian::convertTo<u32>(&data[ofs + 0x40004]);
+        gbo = activePartition({data.get(), length}, GBOOffset) * 0x40000;
+    }
 
-        CountType cmp = compareCounters(major1, major2);
-        if (cmp == CountType::FIRST)
-        {
-            sbo = 0;
-        }
-        else if (cmp == CountType::SECOND)
-        {
-            sbo = 0x40000;
-        }
-        else
-        {
-            cmp = compareCounters(minor1, minor2);
-            if (cmp == CountType::SECOND)
-            {
-                sbo = 0x40000;
-            }
-            else
-            {
-                sbo = 0;
-            }
-        }
+    void Sav4::SBO(void)
+    {
+        sbo = activePartition({data.get(), length}, SBOOffset) * 0x40000;
     }
 
     void Sav4::resign(void)
@@ -321,6 +297,16 @@ namespace pksm
         return PKX::getPKM<Generation::FOUR>(&data[boxOffset(box, slot)], PK4::BOX_LENGTH);
     }
 
+    bool Sav4::pkmInto(PKX& out, u8 slot) const
+    {
+        return PKX::getPKM<Generation::FOUR>(out, &data[partyOffset(slot)], PK4::PARTY_LENGTH);
+    }
+
+    bool Sav4::pkmInto(PKX& out, u8 box, u8 slot) const
+    {
+        return PKX::getPKM<Generation::FOUR>(out, &data[boxOffset(box, slot)], PK4::BOX_LENGTH);
+    }
+
     void Sav4::pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)
     {
         if (pk.generation() == Generation::FOUR)
@@ -333,6 +319,7 @@ namespace pksm
 
             std::ranges::copy(
                 pkm->rawData().subspan(0, PK4::BOX_LENGTH), &data[boxOffset(box, slot)]);
+            boxSlotWritten(*pkm, box, slot);
         }
     }
 
@@ -348,19 +335,26 @@ namespace pksm
     }
 
     void Sav4::cryptBoxData(bool crypted)
+    {
+        // HGSS pads every box, so each one has to be done separately
+        for (u8 box = 0; box < maxBoxes(); box++)
+        {
+            pksm::crypto::pkm::cryptBoxData(Generation::FOUR,
+                {&data[boxOffset(box, 0)], PK4::BOX_LENGTH * 30}, PK4::BOX_LENGTH, crypted);
+        }
+    }
+
+    bool Sav4::visitBoxSlots(SlotVisitor visitor, void* context) const
     {
         for (u8 box = 0; box < maxBoxes(); box++)
         {
             for (u8 slot = 0; slot < 30; slot++)
             {
-                std::unique_ptr<PKX> pk4 = PKX::getPKM<Generation::FOUR>(
-                    &data[boxOffset(box, slot)], PK4::BOX_LENGTH, true);
-                if (!crypted)
-                {
-                    pk4->encrypt();
-                }
+                visitBoxSlot(
+                    visitor, context, box, slot, &data[boxOffset(box, slot)], PK4::BOX_LENGTH);
             }
         }
+        return true;
     }
 
     bool Sav4::giftsMenuActivated(void) const
@@ -466,7 +460,7 @@ namespace pksm
 
     void Sav4::dex(const PKX& pk)
     {
-        if (!(availableSpecies().count(pk.species()) > 0) || pk.egg())
+        if (!legalityBits().hasSpecies(pk.species()) || pk.egg())
         {
             return;
         }
@@ -608,7 +602,7 @@ namespace pksm
         int ret                     = 0;
         static constexpr int brSize = 0x40;
         int ofs                     = PokeDex + 0x4;
-        for (const auto& spec : availableSpecies())
+        for (const auto& spec : speciesList())
         {
             u16 i   = u16(spec);
             int bit = i - 1;
@@ -627,7 +621,7 @@ namespace pksm
     {
         int ret = 0;
         int ofs = PokeDex + 0x4;
-        for (const auto& spec : availableSpecies())
+        for (const auto& spec : speciesList())
         {
             u16 i   = u16(spec);
             int bit = i - 1;
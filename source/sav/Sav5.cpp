@@ -42,6 +42,7 @@ namespace pksm
     void Sav5::TID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[Trainer1 + 0x14], v);
+        markDirty(Trainer1 + 0x14, sizeof(u16));
     }
 
     u16 Sav5::SID(void) const
@@ -52,6 +53,7 @@ namespace pksm
     void Sav5::SID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[Trainer1 + 0x16], v);
+        markDirty(Trainer1 + 0x16, sizeof(u16));
     }
 
     GameVersion Sav5::version(void) const
@@ -62,6 +64,7 @@ namespace pksm
     void Sav5::version(GameVersion v)
     {
         data[Trainer1 + 0x1F] = u8(v);
+        markDirty(Trainer1 + 0x1F);
     }
 
     Gender Sav5::gender(void) const
@@ -72,6 +75,7 @@ namespace pksm
     void Sav5::gender(Gender v)
     {
         data[Trainer1 + 0x21] = u8(v);
+        markDirty(Trainer1 + 0x21);
     }
 
     Language Sav5::language(void) const
@@ -82,6 +86,7 @@ namespace pksm
     void Sav5::language(Language v)
     {
         data[Trainer1 + 0x1E] = u8(v);
+        markDirty(Trainer1 + 0x1E);
     }
 
     std::string Sav5::otName(void) const
@@ -94,6 +99,7 @@ namespace pksm
     {
         StringUtils::setString(
             data.get(), StringUtils::transString45(v), Trainer1 + 0x4, 8, u'\uFFFF', 0);
+        markDirty(Trainer1 + 0x4, 8 * sizeof(u16));
     }
 
     u32 Sav5::money(void) const
@@ -104,6 +110,7 @@ namespace pksm
     void Sav5::money(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[Trainer2], v);
+        markDirty(Trainer2, sizeof(u32));
     }
 
     u32 Sav5::BP(void) const
@@ -114,6 +121,7 @@ namespace pksm
     void Sav5::BP(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[BattleSubway], v);
+        markDirty(BattleSubway, sizeof(u32));
     }
 
     u8 Sav5::badges(void) const
@@ -135,6 +143,7 @@ namespace pksm
     void Sav5::playedHours(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[Trainer1 + 0x24], v);
+        markDirty(Trainer1 + 0x24, sizeof(u16));
     }
 
     u8 Sav5::playedMinutes(void) const
@@ -145,6 +154,7 @@ namespace pksm
     void Sav5::playedMinutes(u8 v)
     {
         data[Trainer1 + 0x26] = v;
+        markDirty(Trainer1 + 0x26);
     }
 
     u8 Sav5::playedSeconds(void) const
@@ -155,6 +165,7 @@ namespace pksm
     void Sav5::playedSeconds(u8 v)
     {
         data[Trainer1 + 0x27] = v;
+        markDirty(Trainer1 + 0x27);
     }
 
     u8 Sav5::currentBox(void) const
@@ -165,6 +176,7 @@ namespace pksm
     void Sav5::currentBox(u8 v)
     {
         data[PCLayout] = v;
+        markDirty(PCLayout);
     }
 
     u8 Sav5::unlockedBoxes(void) const
@@ -175,6 +187,7 @@ namespace pksm
     void Sav5::unlockedBoxes(u8 v)
     {
         data[PCLayout + 0x3DD] = v;
+        markDirty(PCLayout + 0x3DD);
     }
 
     u32 Sav5::boxOffset(u8 box, u8 slot) const
@@ -199,6 +212,7 @@ namespace pksm
             auto pk5 = pk.partyClone();
             pk5->encrypt();
             std::ranges::copy(pk5->rawData(), &data[partyOffset(slot)]);
+            markDirty(partyOffset(slot), PK5::PARTY_LENGTH);
         }
     }
 
@@ -207,6 +221,16 @@ namespace pksm
         return PKX::getPKM<Generation::FIVE>(&data[boxOffset(box, slot)], PK5::BOX_LENGTH);
     }
 
+    bool Sav5::pkmInto(PKX& out, u8 slot) const
+    {
+        return PKX::getPKM<Generation::FIVE>(out, &data[partyOffset(slot)], PK5::PARTY_LENGTH);
+    }
+
+    bool Sav5::pkmInto(PKX& out, u8 box, u8 slot) const
+    {
+        return PKX::getPKM<Generation::FIVE>(out, &data[boxOffset(box, slot)], PK5::BOX_LENGTH);
+    }
+
     void Sav5::pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)
     {
         if (pk.generation() == Generation::FIVE)
@@ -219,6 +243,8 @@ namespace pksm
 
             std::ranges::copy(
                 pk5->rawData().subspan(0, PK5::BOX_LENGTH), &data[boxOffset(box, slot)]);
+            markDirty(boxOffset(box, slot), PK5::BOX_LENGTH);
+            boxSlotWritten(*pk5, box, slot);
         }
     }
 
@@ -234,19 +260,27 @@ namespace pksm
     }
 
     void Sav5::cryptBoxData(bool crypted)
+    {
+        // Every box is padded, so each one has to be done separately
+        for (u8 box = 0; box < maxBoxes(); box++)
+        {
+            pksm::crypto::pkm::cryptBoxData(Generation::FIVE,
+                {&data[boxOffset(box, 0)], PK5::BOX_LENGTH * 30}, PK5::BOX_LENGTH, crypted);
+            markDirty(boxOffset(box, 0), PK5::BOX_LENGTH * 30);
+        }
+    }
+
+    bool Sav5::visitBoxSlots(SlotVisitor visitor, void* context) const
     {
         for (u8 box = 0; box < maxBoxes(); box++)
         {
             for (u8 slot = 0; slot < 30; slot++)
             {
-                std::unique_ptr<PKX> pk5 = PKX::getPKM<Generation::FIVE>(
-                    &data[boxOffset(box, slot)], PK5::BOX_LENGTH, true);
-                if (!crypted)
-                {
-                    pk5->encrypt();
-                }
+                visitBoxSlot(
+                    visitor, context, box, slot, &data[boxOffset(box, slot)], PK5::BOX_LENGTH);
             }
         }
+        return true;
     }
 
     int Sav5::dexFormIndex(int species, int formct) const
@@ -314,7 +348,7 @@ namespace pksm
 
     void Sav5::dex(const PKX& pk)
     {
-        if (!(availableSpecies().count(pk.species()) > 0) || pk.egg())
+        if (!legalityBits().hasSpecies(pk.species()) || pk.egg())
         {
             return;
         }
@@ -329,9 +363,11 @@ namespace pksm
 
         // Set the Species Owned Flag
         data[ofs + brSize * 0] |= (1 << (bit % 8));
+        markDirty(ofs + brSize * 0);
 
         // Set the [Species/Gender/Shiny] Seen Flag
         data[PokeDex + 0x8 + shiftoff + bit / 8] |= (1 << (bit & 7));
+        markDirty(PokeDex + 0x8 + shiftoff + bit / 8);
 
         // Set the Display flag if none are set
         bool displayed = false;
@@ -343,6 +379,7 @@ namespace pksm
         { // offset is already biased by brSize, reuse shiftoff but for the display
           // flags.
             data[ofs + brSize * (shift + 4)] |= (1 << (bit & 7));
+            markDirty(ofs + brSize * (shift + 4));
         }
 
         // Set the Language
@@ -358,6 +395,7 @@ namespace pksm
                 lang = 1;
             }
             data[PokeDexLanguageFlags + ((bit * 7 + lang) >> 3)] |= (1 << ((bit * 7 + lang) & 7));
+            markDirty(PokeDexLanguageFlags + ((bit * 7 + lang) >> 3));
         }
 
         // Formes
@@ -374,6 +412,7 @@ namespace pksm
 
         // Set Form Seen Flag
         data[formDex + formLen * shiny + (bit >> 3)] |= (1 << (bit & 7));
+        markDirty(formDex + formLen * shiny + (bit >> 3));
 
         // Set displayed Flag if necessary, check all flags
         for (int i = 0; i < fc; i++)
@@ -390,12 +429,13 @@ namespace pksm
         }
         bit                                                = f + pk.alternativeForm();
         data[formDex + formLen * (2 + shiny) + (bit >> 3)] |= (1 << (bit & 7));
+        markDirty(formDex + formLen * (2 + shiny) + (bit >> 3));
     }
 
     int Sav5::dexSeen(void) const
     {
         int ret = 0;
-        for (const auto& spec : availableSpecies())
+        for (const auto& spec : speciesList())
         {
             u16 i        = u16(spec);
             int bitIndex = (i - 1) & 7;
@@ -415,7 +455,7 @@ namespace pksm
     int Sav5::dexCaught(void) const
     {
         int ret = 0;
-        for (const auto& spec : availableSpecies())
+        for (const auto& spec : speciesList())
         {
             u16 i        = u16(spec);
             int bitIndex = (i - 1) & 7;
@@ -433,8 +473,10 @@ namespace pksm
         if (wc.generation() == Generation::FIVE)
         {
             data[WondercardFlags + (wc.ID() / 8)] |= 0x1 << (wc.ID() & 7);
+            markDirty(WondercardFlags + (wc.ID() / 8));
             std::copy(wc.rawData(), wc.rawData() + PGF::length,
                 &data[WondercardData + pos * PGF::length]);
+            markDirty(WondercardData + pos * PGF::length, PGF::length);
             pos = (pos + 1) % 12;
         }
     }
@@ -449,6 +491,7 @@ namespace pksm
     {
         StringUtils::setString(data.get(), StringUtils::transString45(name),
             PCLayout + 0x28 * box + 4, 9, u'\uFFFF', 0);
+        markDirty(PCLayout + 0x28 * box + 4, 9 * sizeof(u16));
     }
 
     u8 Sav5::boxWallpaper(u8 box) const
@@ -459,6 +502,7 @@ namespace pksm
     void Sav5::boxWallpaper(u8 box, u8 v)
     {
         data[PCLayout + 0x3C4 + box] = v;
+        markDirty(PCLayout + 0x3C4 + box);
     }
 
     u8 Sav5::partyCount(void) const
@@ -469,6 +513,7 @@ namespace pksm
     void Sav5::partyCount(u8 v)
     {
         data[Party + 4] = v;
+        markDirty(Party + 4);
     }
 
     std::unique_ptr<PKX> Sav5::emptyPkm() const
@@ -505,6 +550,7 @@ namespace pksm
     {
         u32 seed = LittleEndian::convertTo<u32>(&data[0x1D290]);
         pksm::crypto::pkm::crypt<0xA90>(&data[WondercardFlags], seed);
+        markDirty(WondercardFlags, 0xA90);
     }
 
     std::unique_ptr<WCX> Sav5::mysteryGift(int pos) const
@@ -520,18 +566,23 @@ namespace pksm
         {
             case Pouch::NormalItem:
                 std::copy(write.begin(), write.end(), &data[PouchHeldItem + slot * 4]);
+                markDirty(PouchHeldItem + slot * 4, write.size());
                 break;
             case Pouch::KeyItem:
                 std::copy(write.begin(), write.end(), &data[PouchKeyItem + slot * 4]);
+                markDirty(PouchKeyItem + slot * 4, write.size());
                 break;
             case Pouch::TM:
                 std::copy(write.begin(), write.end(), &data[PouchTMHM + slot * 4]);
+                markDirty(PouchTMHM + slot * 4, write.size());
                 break;
             case Pouch::Medicine:
                 std::copy(write.begin(), write.end(), &data[PouchMedicine + slot * 4]);
+                markDirty(PouchMedicine + slot * 4, write.size());
                 break;
             case Pouch::Berry:
                 std::copy(write.begin(), write.end(), &data[PouchBerry + slot * 4]);
+                markDirty(PouchBerry + slot * 4, write.size());
                 break;
             default:
                 return;
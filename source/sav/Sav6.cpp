@@ -26,6 +26,7 @@
 
 #include "sav/Sav6.hpp"
 #include "pkx/PK6.hpp"
+#include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/i18n.hpp"
 #include "utils/random.hpp"
@@ -42,6 +43,7 @@ namespace pksm
     void Sav6::TID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[TrainerCard], v);
+        markDirty(TrainerCard, sizeof(u16));
     }
 
     u16 Sav6::SID(void) const
@@ -52,6 +54,7 @@ namespace pksm
     void Sav6::SID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[TrainerCard + 2], v);
+        markDirty(TrainerCard + 2, sizeof(u16));
     }
 
     GameVersion Sav6::version(void) const
@@ -62,6 +65,7 @@ namespace pksm
     void Sav6::version(GameVersion v)
     {
         data[TrainerCard + 4] = u8(v);
+        markDirty(TrainerCard + 4);
     }
 
     Gender Sav6::gender(void) const
@@ -72,6 +76,7 @@ namespace pksm
     void Sav6::gender(Gender v)
     {
         data[TrainerCard + 5] = u8(v);
+        markDirty(TrainerCard + 5);
     }
 
     u8 Sav6::subRegion(void) const
@@ -82,6 +87,7 @@ namespace pksm
     void Sav6::subRegion(u8 v)
     {
         data[TrainerCard + 0x26] = v;
+        markDirty(TrainerCard + 0x26);
     }
 
     u8 Sav6::country(void) const
@@ -92,6 +98,7 @@ namespace pksm
     void Sav6::country(u8 v)
     {
         data[TrainerCard + 0x27] = v;
+        markDirty(TrainerCard + 0x27);
     }
 
     u8 Sav6::consoleRegion(void) const
@@ -102,6 +109,7 @@ namespace pksm
     void Sav6::consoleRegion(u8 v)
     {
         data[TrainerCard + 0x2C] = v;
+        markDirty(TrainerCard + 0x2C);
     }
 
     Language Sav6::language(void) const
@@ -112,6 +120,7 @@ namespace pksm
     void Sav6::language(Language v)
     {
         data[TrainerCard + 0x2D] = u8(v);
+        markDirty(TrainerCard + 0x2D);
     }
 
     std::string Sav6::otName(void) const
@@ -123,6 +132,7 @@ namespace pksm
     void Sav6::otName(const std::string_view& v)
     {
         StringUtils::setString(data.get(), StringUtils::transString67(v), TrainerCard + 0x48, 13);
+        markDirty(TrainerCard + 0x48, 13 * sizeof(u16));
     }
 
     u32 Sav6::money(void) const
@@ -133,6 +143,7 @@ namespace pksm
     void Sav6::money(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[Trainer2 + 0x8], v);
+        markDirty(Trainer2 + 0x8, sizeof(u32));
     }
 
     u32 Sav6::BP(void) const
@@ -143,6 +154,7 @@ namespace pksm
     void Sav6::BP(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[Trainer2 + (game == Game::XY ? 0x3C : 0x30)], v);
+        markDirty(Trainer2 + (game == Game::XY ? 0x3C : 0x30), sizeof(u32));
     }
 
     u8 Sav6::badges(void) const
@@ -164,6 +176,7 @@ namespace pksm
     void Sav6::playedHours(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[PlayTime], v);
+        markDirty(PlayTime, sizeof(u16));
     }
 
     u8 Sav6::playedMinutes(void) const
@@ -174,6 +187,7 @@ namespace pksm
     void Sav6::playedMinutes(u8 v)
     {
         data[PlayTime + 2] = v;
+        markDirty(PlayTime + 2);
     }
 
     u8 Sav6::playedSeconds(void) const
@@ -184,6 +198,7 @@ namespace pksm
     void Sav6::playedSeconds(u8 v)
     {
         data[PlayTime + 3] = v;
+        markDirty(PlayTime + 3);
     }
 
     u8 Sav6::currentBox(void) const
@@ -194,6 +209,7 @@ namespace pksm
     void Sav6::currentBox(u8 v)
     {
         data[LastViewedBox] = v;
+        markDirty(LastViewedBox);
     }
 
     u8 Sav6::unlockedBoxes(void) const
@@ -204,6 +220,7 @@ namespace pksm
     void Sav6::unlockedBoxes(u8 v)
     {
         data[LastViewedBox - 1] = v;
+        markDirty(LastViewedBox - 1);
     }
 
     u32 Sav6::boxOffset(u8 box, u8 slot) const
@@ -228,6 +245,7 @@ namespace pksm
             auto pk6 = pk.partyClone();
             pk6->encrypt();
             std::ranges::copy(pk6->rawData(), &data[partyOffset(slot)]);
+            markDirty(partyOffset(slot), PK6::PARTY_LENGTH);
         }
     }
 
@@ -236,6 +254,16 @@ namespace pksm
         return PKX::getPKM<Generation::SIX>(&data[boxOffset(box, slot)], PK6::BOX_LENGTH);
     }
 
+    bool Sav6::pkmInto(PKX& out, u8 slot) const
+    {
+        return PKX::getPKM<Generation::SIX>(out, &data[partyOffset(slot)], PK6::PARTY_LENGTH);
+    }
+
+    bool Sav6::pkmInto(PKX& out, u8 box, u8 slot) const
+    {
+        return PKX::getPKM<Generation::SIX>(out, &data[boxOffset(box, slot)], PK6::BOX_LENGTH);
+    }
+
     void Sav6::pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)
     {
         if (pk.generation() == Generation::SIX)
@@ -248,6 +276,8 @@ namespace pksm
 
             std::ranges::copy(
                 pkm->rawData().subspan(0, PK6::BOX_LENGTH), &data[boxOffset(box, slot)]);
+            markDirty(boxOffset(box, slot), PK6::BOX_LENGTH);
+            boxSlotWritten(*pkm, box, slot);
         }
     }
 
@@ -339,19 +369,23 @@ namespace pksm
     }
 
     void Sav6::cryptBoxData(bool crypted)
+    {
+        pksm::crypto::pkm::cryptBoxData(Generation::SIX,
+            {&data[Box], PK6::BOX_LENGTH * 30 * maxBoxes()}, PK6::BOX_LENGTH, crypted);
+        markDirty(Box, PK6::BOX_LENGTH * 30 * maxBoxes());
+    }
+
+    bool Sav6::visitBoxSlots(SlotVisitor visitor, void* context) const
     {
         for (u8 box = 0; box < maxBoxes(); box++)
         {
             for (u8 slot = 0; slot < 30; slot++)
             {
-                std::unique_ptr<PKX> pk6 = PKX::getPKM<Generation::SIX>(
-                    &data[boxOffset(box, slot)], PK6::BOX_LENGTH, true);
-                if (!crypted)
-                {
-                    pk6->encrypt();
-                }
+                visitBoxSlot(
+                    visitor, context, box, slot, &data[boxOffset(box, slot)], PK6::BOX_LENGTH);
             }
         }
+        return true;
     }
 
     int Sav6::dexFormIndex(int species, int formct) const
@@ -541,7 +575,7 @@ namespace pksm
 
     void Sav6::dex(const PKX& pk)
     {
-        if (!(availableSpecies().count(pk.species()) > 0) || pk.egg())
+        if (!legalityBits().hasSpecies(pk.species()) || pk.egg())
         {
             return;
         }
@@ -565,14 +599,17 @@ namespace pksm
         if (pk.version() < GameVersion::X && bit < 649 && game != Game::ORAS)
         { // Species: 1-649 for X/Y, and not for ORAS; Set the Foreign Owned Flag
             data[ofs + 0x644] |= mask;
+            markDirty(ofs + 0x644);
         }
         else if (pk.version() >= GameVersion::X || game == Game::ORAS)
         { // Set Native Owned Flag (should always happen)
             data[ofs + (brSize * 0)] |= mask;
+            markDirty(ofs + (brSize * 0));
         }
 
         // Set the [Species/Gender/Shiny] Seen Flag
         data[ofs + shiftoff] |= mask;
+        markDirty(ofs + shiftoff);
 
         // Set the Display flag if none are set
         bool displayed = false;
@@ -584,6 +621,7 @@ namespace pksm
         { // offset is already biased by brSize, reuse shiftoff but for the display
           // flags.
             data[ofs + brSize * 4 + shiftoff] |= mask;
+            markDirty(ofs + brSize * 4 + shiftoff);
         }
 
         // Set the Language
@@ -592,12 +630,14 @@ namespace pksm
             lang = 1;
         }
         data[PokeDexLanguageFlags + (bit * 7 + lang) / 8] |= (u8)(1 << ((bit * 7 + lang) % 8));
+        markDirty(PokeDexLanguageFlags + (bit * 7 + lang) / 8);
 
         // Set DexNav count (only if not encountered previously)
         if (game == Game::ORAS &&
             LittleEndian::convertTo<u16>(&data[EncounterCount + (u16(pk.species()) - 1) * 2]) == 0)
         {
             LittleEndian::convertFrom<u16>(&data[EncounterCount + (u16(pk.species()) - 1) * 2], 1);
+            markDirty(EncounterCount + (u16(pk.species()) - 1) * 2, sizeof(u16));
         }
 
         // Set Form flags
@@ -614,6 +654,7 @@ namespace pksm
 
         // Set Form Seen Flag
         data[formDex + formLen * shiny + bit / 8] |= (u8)(1 << (bit % 8));
+        markDirty(formDex + formLen * shiny + bit / 8);
 
         // Set Displayed Flag if necessary, check all flags
         for (int i = 0; i < fc; i++)
@@ -630,12 +671,13 @@ namespace pksm
         }
         bit                                             = f + pk.alternativeForm();
         data[formDex + formLen * (2 + shiny) + bit / 8] |= (u8)(1 << (bit % 8));
+        markDirty(formDex + formLen * (2 + shiny) + bit / 8);
     }
 
     int Sav6::dexSeen(void) const
     {
         int ret = 0;
-        for (const auto& spec : availableSpecies())
+        for (const auto& spec : speciesList())
         {
             u16 i        = u16(spec);
             int bitIndex = (i - 1) & 7;
@@ -655,7 +697,7 @@ namespace pksm
     int Sav6::dexCaught(void) const
     {
         int ret = 0;
-        for (const auto& spec : availableSpecies())
+        for (const auto& spec : speciesList())
         {
             u16 i        = u16(spec);
             int bitIndex = (i - 1) & 7;
@@ -673,13 +715,17 @@ namespace pksm
         if (wc.generation() == Generation::SIX)
         {
             data[WondercardFlags + wc.ID() / 8] |= 0x1 << (wc.ID() % 8);
+            markDirty(WondercardFlags + wc.ID() / 8);
             std::copy(wc.rawData(), wc.rawData() + WC6::length,
                 &data[WondercardData + WC6::length * pos]);
+            markDirty(WondercardData + WC6::length * pos, WC6::length);
             if (game == Game::ORAS && wc.ID() == 2048 && wc.object() == 726)
             {
                 static constexpr u32 EON_MAGIC = 0x225D73C2;
                 LittleEndian::convertFrom<u32>(&data[0x319B8], EON_MAGIC);
+                markDirty(0x319B8, sizeof(u32));
                 LittleEndian::convertFrom<u32>(&data[0x319DE], EON_MAGIC);
+                markDirty(0x319DE, sizeof(u32));
             }
             pos = (pos + 1) % 24;
         }
@@ -695,6 +741,7 @@ namespace pksm
     {
         StringUtils::setString(
             data.get(), StringUtils::transString67(name), PCLayout + 0x22 * box, 17);
+        markDirty(PCLayout + 0x22 * box, 17 * sizeof(u16));
     }
 
     u8 Sav6::boxWallpaper(u8 box) const
@@ -705,6 +752,7 @@ namespace pksm
     void Sav6::boxWallpaper(u8 box, u8 v)
     {
         data[0x4400 + 1054 + box] = v;
+        markDirty(0x4400 + 1054 + box);
     }
 
     u8 Sav6::partyCount(void) const
@@ -715,6 +763,7 @@ namespace pksm
     void Sav6::partyCount(u8 v)
     {
         data[Party + 6 * PK6::PARTY_LENGTH] = v;
+        markDirty(Party + 6 * PK6::PARTY_LENGTH);
     }
 
     std::unique_ptr<PKX> Sav6::emptyPkm() const
@@ -760,18 +809,23 @@ namespace pksm
         {
             case Pouch::NormalItem:
                 std::copy(write.begin(), write.end(), &data[PouchHeldItem + slot * 4]);
+                markDirty(PouchHeldItem + slot * 4, write.size());
                 break;
             case Pouch::KeyItem:
                 std::copy(write.begin(), write.end(), &data[PouchKeyItem + slot * 4]);
+                markDirty(PouchKeyItem + slot * 4, write.size());
                 break;
             case Pouch::TM:
                 std::copy(write.begin(), write.end(), &data[PouchTMHM + slot * 4]);
+                markDirty(PouchTMHM + slot * 4, write.size());
                 break;
             case Pouch::Medicine:
                 std::copy(write.begin(), write.end(), &data[PouchMedicine + slot * 4]);
+                markDirty(PouchMedicine + slot * 4, write.size());
                 break;
             case Pouch::Berry:
                 std::copy(write.begin(), write.end(), &data[PouchBerry + slot * 4]);
+                markDirty(PouchBerry + slot * 4, write.size());
                 break;
             default:
                 return;
@@ -26,6 +26,7 @@
 
 #include "sav/Sav7.hpp"
 #include "pkx/PK7.hpp"
+#include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/i18n.hpp"
 #include "utils/utils.hpp"
@@ -41,6 +42,7 @@ namespace pksm
     void Sav7::TID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[TrainerCard], v);
+        markDirty(TrainerCard, sizeof(u16));
     }
 
     u16 Sav7::SID(void) const
@@ -51,6 +53,7 @@ namespace pksm
     void Sav7::SID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[TrainerCard + 2], v);
+        markDirty(TrainerCard + 2, sizeof(u16));
     }
 
     GameVersion Sav7::version(void) const
@@ -61,6 +64,7 @@ namespace pksm
     void Sav7::version(GameVersion v)
     {
         data[TrainerCard + 4] = u8(v);
+        markDirty(TrainerCard + 4);
     }
 
     Gender Sav7::gender(void) const
@@ -71,6 +75,7 @@ namespace pksm
     void Sav7::gender(Gender v)
     {
         data[TrainerCard + 5] = u8(v);
+        markDirty(TrainerCard + 5);
     }
 
     u8 Sav7::subRegion(void) const
@@ -81,6 +86,7 @@ namespace pksm
     void Sav7::subRegion(u8 v)
     {
         data[TrainerCard + 0x2E] = v;
+        markDirty(TrainerCard + 0x2E);
     }
 
     u8 Sav7::country(void) const
@@ -91,6 +97,7 @@ namespace pksm
     void Sav7::country(u8 v)
     {
         data[TrainerCard + 0x2F] = v;
+        markDirty(TrainerCard + 0x2F);
     }
 
     u8 Sav7::consoleRegion(void) const
@@ -101,6 +108,7 @@ namespace pksm
     void Sav7::consoleRegion(u8 v)
     {
         data[TrainerCard + 0x34] = v;
+        markDirty(TrainerCard + 0x34);
     }
 
     Language Sav7::language(void) const
@@ -111,6 +119,7 @@ namespace pksm
     void Sav7::language(Language v)
     {
         data[TrainerCard + 0x35] = u8(v);
+        markDirty(TrainerCard + 0x35);
     }
 
     std::string Sav7::otName(void) const
@@ -121,8 +130,8 @@ namespace pksm
 
     void Sav7::otName(const std::string_view& v)
     {
-        return StringUtils::setString(
-            data.get(), StringUtils::transString67(v), TrainerCard + 0x38, 13);
+        StringUtils::setString(data.get(), StringUtils::transString67(v), TrainerCard + 0x38, 13);
+        markDirty(TrainerCard + 0x38, 13 * sizeof(u16));
     }
 
     u32 Sav7::money(void) const
@@ -133,6 +142,7 @@ namespace pksm
     void Sav7::money(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[Misc + 0x4], v > 9999999 ? 9999999 : v);
+        markDirty(Misc + 0x4, sizeof(u32));
     }
 
     u32 Sav7::BP(void) const
@@ -143,6 +153,7 @@ namespace pksm
     void Sav7::BP(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[Misc + 0x11C], v > 9999 ? 9999 : v);
+        markDirty(Misc + 0x11C, sizeof(u32));
     }
 
     u8 Sav7::badges(void) const
@@ -164,6 +175,7 @@ namespace pksm
     void Sav7::playedHours(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[PlayTime], v);
+        markDirty(PlayTime, sizeof(u16));
     }
 
     u8 Sav7::playedMinutes(void) const
@@ -174,6 +186,7 @@ namespace pksm
     void Sav7::playedMinutes(u8 v)
     {
         data[PlayTime + 2] = v;
+        markDirty(PlayTime + 2);
     }
 
     u8 Sav7::playedSeconds(void) const
@@ -184,6 +197,7 @@ namespace pksm
     void Sav7::playedSeconds(u8 v)
     {
         data[PlayTime + 3] = v;
+        markDirty(PlayTime + 3);
     }
 
     u8 Sav7::currentBox(void) const
@@ -194,6 +208,7 @@ namespace pksm
     void Sav7::currentBox(u8 v)
     {
         data[LastViewedBox] = v;
+        markDirty(LastViewedBox);
     }
 
     u8 Sav7::unlockedBoxes(void) const
@@ -204,6 +219,7 @@ namespace pksm
     void Sav7::unlockedBoxes(u8 v)
     {
         data[LastViewedBox - 2] = v;
+        markDirty(LastViewedBox - 2);
     }
 
     u32 Sav7::boxOffset(u8 box, u8 slot) const
@@ -228,6 +244,7 @@ namespace pksm
             auto pk7 = pk.partyClone();
             pk7->encrypt();
             std::ranges::copy(pk7->rawData(), &data[partyOffset(slot)]);
+            markDirty(partyOffset(slot), PK7::PARTY_LENGTH);
         }
     }
 
@@ -236,6 +253,16 @@ namespace pksm
         return PKX::getPKM<Generation::SEVEN>(&data[boxOffset(box, slot)], PK7::BOX_LENGTH);
     }
 
+    bool Sav7::pkmInto(PKX& out, u8 slot) const
+    {
+        return PKX::getPKM<Generation::SEVEN>(out, &data[partyOffset(slot)], PK7::PARTY_LENGTH);
+    }
+
+    bool Sav7::pkmInto(PKX& out, u8 box, u8 slot) const
+    {
+        return PKX::getPKM<Generation::SEVEN>(out, &data[boxOffset(box, slot)], PK7::BOX_LENGTH);
+    }
+
     void Sav7::pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)
     {
         if (pk.generation() == Generation::SEVEN)
@@ -248,6 +275,8 @@ namespace pksm
 
             std::ranges::copy(
                 pkm->rawData().subspan(0, PK7::BOX_LENGTH), &data[boxOffset(box, slot)]);
+            markDirty(boxOffset(box, slot), PK7::BOX_LENGTH);
+            boxSlotWritten(*pkm, box, slot);
         }
     }
 
@@ -285,19 +314,23 @@ namespace pksm
     }
 
     void Sav7::cryptBoxData(bool crypted)
+    {
+        pksm::crypto::pkm::cryptBoxData(Generation::SEVEN,
+            {&data[Box], PK7::BOX_LENGTH * 30 * maxBoxes()}, PK7::BOX_LENGTH, crypted);
+        markDirty(Box, PK7::BOX_LENGTH * 30 * maxBoxes());
+    }
+
+    bool Sav7::visitBoxSlots(SlotVisitor visitor, void* context) const
     {
         for (u8 box = 0; box < maxBoxes(); box++)
         {
             for (u8 slot = 0; slot < 30; slot++)
             {
-                std::unique_ptr<PKX> pk7 = PKX::getPKM<Generation::SEVEN>(
-                    &data[boxOffset(box, slot)], PK7::BOX_LENGTH, true);
-                if (!crypted)
-                {
-                    pk7->encrypt();
-                }
+                visitBoxSlot(
+                    visitor, context, box, slot, &data[boxOffset(box, slot)], PK7::BOX_LENGTH);
             }
         }
+        return true;
     }
 
     void Sav7::setDexFlags(int index, int gender, int shiny, int baseSpecies)
@@ -312,6 +345,7 @@ namespace pksm
 
         int brSeen              = shift * brSize;
         data[ofs + brSeen + bd] |= 1 << bm;
+        markDirty(ofs + brSeen + bd);
 
         bool displayed = false;
         for (u8 i = 0; i < 4; i++)
@@ -334,6 +368,7 @@ namespace pksm
         }
 
         data[ofs + (4 + shift) * brSize + bd] |= (1 << bm);
+        markDirty(ofs + (4 + shift) * brSize + bd);
     }
 
     int Sav7::getDexFlags(int index, int baseSpecies) const
@@ -428,7 +463,7 @@ namespace pksm
 
     void Sav7::dex(const PKX& pk)
     {
-        if (!(availableSpecies().count(pk.species()) > 0) || pk.egg())
+        if (!legalityBits().hasSpecies(pk.species()) || pk.egg())
         {
             return;
         }
@@ -450,7 +485,9 @@ namespace pksm
             { // Already 2
                 LittleEndian::convertFrom<u32>(
                     &data[PokeDex + 0x8E8 + shift * 4], pk.encryptionConstant());
+                markDirty(PokeDex + 0x8E8 + shift * 4, sizeof(u32));
                 data[PokeDex + 0x84] |= (u8)(1 << shift);
+                markDirty(PokeDex + 0x84);
             }
             else if ((data[PokeDex + 0x84] & (1 << shift)) == 0)
             {                                             // Not yet 1
@@ -459,7 +496,9 @@ namespace pksm
         }
 
         int off        = PokeDex + 0x08 + 0x80;
+                markDirty(PokeDex + 0x84);
         data[off + bd] |= 1 << bm;
+        markDirty(off + bd);
 
         int formstart = pk.alternativeForm();
         int formend   = formstart;
@@ -507,6 +546,7 @@ namespace pksm
             if (lbit >> 3 < 920)
             {
                 data[PokeDexLanguageFlags + (lbit >> 3)] |= (1 << (lbit & 7));
+                markDirty(PokeDexLanguageFlags + (lbit >> 3));
             }
         }
     }
@@ -514,7 +554,7 @@ namespace pksm
     int Sav7::dexSeen(void) const
     {
         int ret = 0;
-        for (const auto& spec : availableSpecies())
+        for (const auto& spec : speciesList())
         {
             u16 species = u16(spec);
             int forms   = formCount(spec);
@@ -543,7 +583,7 @@ namespace pksm
     int Sav7::dexCaught(void) const
     {
         int ret = 0;
-        for (const auto& spec : availableSpecies())
+        for (const auto& spec : speciesList())
         {
             u16 i        = u16(spec);
             int bitIndex = (i - 1) & 7;
@@ -561,8 +601,10 @@ namespace pksm
         if (wc.generation() == Generation::SEVEN)
         {
             data[WondercardFlags + wc.ID() / 8] |= 0x1 << (wc.ID() % 8);
+            markDirty(WondercardFlags + wc.ID() / 8);
             std::copy(wc.rawData(), wc.rawData() + WC7::length,
                 &data[WondercardData + WC7::length * pos]);
+            markDirty(WondercardData + WC7::length * pos, WC7::length);
             pos = (pos + 1) % maxWondercards();
         }
     }
@@ -577,6 +619,7 @@ namespace pksm
     {
         StringUtils::setString(
             data.get(), StringUtils::transString67(name), PCLayout + 0x22 * box, 17);
+        markDirty(PCLayout + 0x22 * box, 17 * sizeof(u16));
     }
 
     u8 Sav7::boxWallpaper(u8 box) const
@@ -587,6 +630,7 @@ namespace pksm
     void Sav7::boxWallpaper(u8 box, u8 v)
     {
         data[PCLayout + 1472 + box] = v;
+        markDirty(PCLayout + 1472 + box);
     }
 
     u8 Sav7::partyCount(void) const
@@ -597,6 +641,7 @@ namespace pksm
     void Sav7::partyCount(u8 v)
     {
         data[Party + 6 * PK7::PARTY_LENGTH] = v;
+        markDirty(Party + 6 * PK7::PARTY_LENGTH);
     }
 
     std::unique_ptr<PKX> Sav7::emptyPkm() const
@@ -642,24 +687,31 @@ namespace pksm
         {
             case Pouch::NormalItem:
                 std::copy(write.begin(), write.end(), &data[PouchHeldItem + slot * 4]);
+                markDirty(PouchHeldItem + slot * 4, write.size());
                 break;
             case Pouch::KeyItem:
                 std::copy(write.begin(), write.end(), &data[PouchKeyItem + slot * 4]);
+                markDirty(PouchKeyItem + slot * 4, write.size());
                 break;
             case Pouch::TM:
                 std::copy(write.begin(), write.end(), &data[PouchTMHM + slot * 4]);
+                markDirty(PouchTMHM + slot * 4, write.size());
                 break;
             case Pouch::Medicine:
                 std::copy(write.begin(), write.end(), &data[PouchMedicine + slot * 4]);
+                markDirty(PouchMedicine + slot * 4, write.size());
                 break;
             case Pouch::Berry:
                 std::copy(write.begin(), write.end(), &data[PouchBerry + slot * 4]);
+                markDirty(PouchBerry + slot * 4, write.size());
                 break;
             case Pouch::ZCrystals:
                 std::copy(write.begin(), write.end(), &data[PouchZCrystals + slot * 4]);
+                markDirty(PouchZCrystals + slot * 4, write.size());
                 break;
             case Pouch::RotomPower:
                 std::copy(write.begin(), write.end(), &data[BattleItems + slot * 4]);
+                markDirty(BattleItems + slot * 4, write.size());
                 break;
             default:
                 return;
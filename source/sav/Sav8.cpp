@@ -33,20 +33,17 @@ namespace pksm
     Sav8::Sav8(const std::shared_ptr<u8[]>& dt, size_t length) : Sav(dt, length)
     {
         pksm::crypto::swsh::applyXor(dt, length);
-        blocks = pksm::crypto::swsh::getBlockList(dt, length);
+        blocks = pksm::crypto::swsh::SCBlockList(dt, length);
     }
 
     std::shared_ptr<pksm::crypto::swsh::SCBlock> Sav8::getBlock(u32 key) const
     {
-        // binary search
-        auto found = std::lower_bound(blocks.begin(), blocks.end(), key,
-            [](const std::shared_ptr<pksm::crypto::swsh::SCBlock>& block, u32 key)
-            { return block->key() < key; });
-        if ((*found)->key() != key)
-        {
-            return nullptr;
-        }
-        return *found;
+        return blocks.get(key);
+    }
+
+    pksm::crypto::swsh::SCBlock* Sav8::rawBlock(u32 key) const
+    {
+        return blocks.find(key);
     }
 
     std::unique_ptr<PKX> Sav8::emptyPkm() const
@@ -93,7 +90,7 @@ namespace pksm
         {
             for (auto& block : blocks)
             {
-                block->encrypt();
+                block.encrypt();
             }
 
             pksm::crypto::swsh::applyXor(data, length);
@@ -113,4 +110,25 @@ namespace pksm
         // I could decrypt every block here, but why not just let them be done on the fly via the
         // functions that need them?
     }
+
+    bool Sav8::exportSnapshot(std::span<u8> out)
+    {
+        if (out.size() < length)
+        {
+            return false;
+        }
+        out = out.first(length);
+        std::copy(data.get(), data.get() + length, out.begin());
+        if (!encrypted)
+        {
+            for (const auto& block : blocks)
+            {
+                block.encryptInto(out);
+            }
+
+            pksm::crypto::swsh::applyXor(out);
+            pksm::crypto::swsh::sign(out);
+        }
+        return true;
+    }
 }
@@ -50,18 +50,27 @@ namespace pksm
         PouchMedicine        = 0x18BD8;
         PouchBerry           = 0x18C98;
         Box                  = 0x400;
+
+        trackChecksumBlocks(blockOfs);
     }
 
     void SavB2W2::resign(void)
     {
         const u8 blockCount = 74;
 
+        // The mirrored checksums live in the last block, so writing one dirties it; it's checksummed
+        // after all the others
         for (u8 i = 0; i < blockCount; i++)
         {
-            u16 cs = pksm::crypto::ccitt16({&data[blockOfs[i]], lengths[i]});
-            LittleEndian::convertFrom<u16>(&data[chkMirror[i]], cs);
-            LittleEndian::convertFrom<u16>(&data[chkofs[i]], cs);
+            if (blockDirty(i))
+            {
+                u16 cs = pksm::crypto::ccitt16({&data[blockOfs[i]], lengths[i]});
+                LittleEndian::convertFrom<u16>(&data[chkMirror[i]], cs);
+                LittleEndian::convertFrom<u16>(&data[chkofs[i]], cs);
+                markDirty(chkMirror[i], sizeof(u16));
+            }
         }
+        clearDirty();
 
         // Memories
         // Note: Block 1 and its mirror are encrypted with pokecrypto. The commented lines show how
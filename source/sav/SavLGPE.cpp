@@ -53,6 +53,8 @@ namespace pksm
     {
         game    = Game::LGPE;
         PokeDex = 0x2A00;
+
+        trackChecksumBlocks(chkofs);
     }
 
     u32 SavLGPE::boxOffset(u8 box, u8 slot) const
@@ -68,6 +70,7 @@ namespace pksm
     void SavLGPE::partyBoxSlot(u8 slot, u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[0x5A00 + slot * 2], v);
+        markDirty(0x5A00 + slot * 2, sizeof(u16));
     }
 
     u32 SavLGPE::partyOffset(u8 slot) const
@@ -88,6 +91,7 @@ namespace pksm
     void SavLGPE::boxedPkm(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[0x5A00 + 14], v);
+        markDirty(0x5A00 + 14, sizeof(u16));
     }
 
     u16 SavLGPE::followPkm() const
@@ -98,6 +102,7 @@ namespace pksm
     void SavLGPE::followPkm(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[0x5A00 + 12], v);
+        markDirty(0x5A00 + 12, sizeof(u16));
     }
 
     u8 SavLGPE::partyCount() const
@@ -148,7 +153,9 @@ namespace pksm
                     std::copy(
                         &data[emptyOffset], &data[emptyOffset + PB7::PARTY_LENGTH], emptyData);
                     std::copy(&data[offset], &data[offset + PB7::PARTY_LENGTH], &data[emptyOffset]);
+                    markDirty(emptyOffset, PB7::PARTY_LENGTH);
                     std::copy(emptyData, emptyData + PB7::PARTY_LENGTH, &data[offset]);
+                    markDirty(offset, PB7::PARTY_LENGTH);
                     for (int j = 0; j < partyCount(); j++)
                     {
                         if (partyBoxSlot(j) == i)
@@ -164,6 +171,7 @@ namespace pksm
                 }
             }
         }
+        boxesRewritten();
     }
 
     void SavLGPE::resign()
@@ -173,9 +181,13 @@ namespace pksm
 
         for (u8 i = 0; i < blockCount; i++)
         {
-            LittleEndian::convertFrom<u16>(
-                &data[csoff + i * 8], pksm::crypto::crc16_noinvert({&data[chkofs[i]], chklen[i]}));
+            if (blockDirty(i))
+            {
+                LittleEndian::convertFrom<u16>(&data[csoff + i * 8],
+                    pksm::crypto::crc16_noinvert({&data[chkofs[i]], chklen[i]}));
+            }
         }
+        clearDirty();
     }
 
     u16 SavLGPE::TID() const
@@ -186,6 +198,7 @@ namespace pksm
     void SavLGPE::TID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[0x1000], v);
+        markDirty(0x1000, sizeof(u16));
     }
 
     u16 SavLGPE::SID() const
@@ -196,6 +209,7 @@ namespace pksm
     void SavLGPE::SID(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[0x1002], v);
+        markDirty(0x1002, sizeof(u16));
     }
 
     GameVersion SavLGPE::version() const
@@ -206,6 +220,7 @@ namespace pksm
     void SavLGPE::version(GameVersion v)
     {
         data[0x1004] = u8(v);
+        markDirty(0x1004);
     }
 
     Gender SavLGPE::gender() const
@@ -216,6 +231,7 @@ namespace pksm
     void SavLGPE::gender(Gender v)
     {
         data[0x1005] = u8(v);
+        markDirty(0x1005);
     }
 
     Language SavLGPE::language() const
@@ -226,6 +242,7 @@ namespace pksm
     void SavLGPE::language(Language v)
     {
         data[0x1035] = u8(v);
+        markDirty(0x1035);
     }
 
     std::string SavLGPE::otName() const
@@ -236,6 +253,7 @@ namespace pksm
     void SavLGPE::otName(const std::string_view& v)
     {
         StringUtils::setString(data.get(), v, 0x1000 + 0x38, 13);
+        markDirty(0x1000 + 0x38, 13 * sizeof(u16));
     }
 
     u32 SavLGPE::money() const
@@ -246,6 +264,7 @@ namespace pksm
     void SavLGPE::money(u32 v)
     {
         LittleEndian::convertFrom<u32>(&data[0x4C04], v);
+        markDirty(0x4C04, sizeof(u32));
     }
 
     u8 SavLGPE::badges() const
@@ -275,6 +294,7 @@ namespace pksm
     void SavLGPE::playedHours(u16 v)
     {
         LittleEndian::convertFrom<u16>(&data[0x45400], v);
+        markDirty(0x45400, sizeof(u16));
     }
 
     u8 SavLGPE::playedMinutes(void) const
@@ -285,6 +305,7 @@ namespace pksm
     void SavLGPE::playedMinutes(u8 v)
     {
         data[0x45402] = v;
+        markDirty(0x45402);
     }
 
     u8 SavLGPE::playedSeconds(void) const
@@ -295,6 +316,7 @@ namespace pksm
     void SavLGPE::playedSeconds(u8 v)
     {
         data[0x45403] = v;
+        markDirty(0x45403);
     }
 
     std::unique_ptr<PKX> SavLGPE::pkm(u8 slot) const
@@ -315,6 +337,24 @@ namespace pksm
         return PKX::getPKM<Generation::LGPE>(&data[boxOffset(box, slot)], PB7::PARTY_LENGTH);
     }
 
+    bool SavLGPE::pkmInto(PKX& out, u8 slot) const
+    {
+        u32 off = partyOffset(slot);
+        if (off != 0)
+        {
+            return PKX::getPKM<Generation::LGPE>(out, &data[off], PB7::PARTY_LENGTH);
+        }
+        else
+        {
+            return Sav::pkmInto(out, slot);
+        }
+    }
+
+    bool SavLGPE::pkmInto(PKX& out, u8 box, u8 slot) const
+    {
+        return PKX::getPKM<Generation::LGPE>(out, &data[boxOffset(box, slot)], PB7::PARTY_LENGTH);
+    }
+
     void SavLGPE::pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)
     {
         if (pk.generation() == Generation::LGPE)
@@ -327,6 +367,8 @@ namespace pksm
 
             std::ranges::copy(
                 pb7->rawData().subspan(0, PB7::PARTY_LENGTH), &data[boxOffset(box, slot)]);
+            markDirty(boxOffset(box, slot), PB7::PARTY_LENGTH);
+            boxSlotWritten(*pb7, box, slot);
         }
     }
 
@@ -341,6 +383,8 @@ namespace pksm
                 if (off != 0)
                 {
                     std::fill_n(&data[off], PB7::PARTY_LENGTH, 0);
+                    markDirty(off, PB7::PARTY_LENGTH);
+                    boxSlotWritten(pk, newSlot / 30, newSlot % 30);
                 }
                 partyBoxSlot(slot, 1001);
                 return;
@@ -364,6 +408,8 @@ namespace pksm
 
             auto pb7 = pk.partyClone();
             std::ranges::copy(pb7->rawData().subspan(0, PB7::PARTY_LENGTH), &data[off]);
+            markDirty(off, PB7::PARTY_LENGTH);
+            boxSlotWritten(*pb7, newSlot / 30, newSlot % 30);
             partyBoxSlot(slot, newSlot);
         }
     }
@@ -463,6 +509,7 @@ namespace pksm
 
         int brSeen              = shift * brSize;
         data[off + brSeen + bd] |= (u8)(1 << bm);
+        markDirty(off + brSeen + bd);
 
         bool displayed = false;
         for (u8 i = 0; i < 4; i++)
@@ -485,6 +532,7 @@ namespace pksm
         }
 
         data[off + (4 + shift) * brSize + bd] |= (1 << bm);
+        markDirty(off + (4 + shift) * brSize + bd);
     }
 
     int SavLGPE::getDexFlags(int index, int baseSpecies) const
@@ -519,7 +567,7 @@ namespace pksm
         int PokeDex              = 0x2A00;
         int PokeDexLanguageFlags = PokeDex + 0x550;
 
-        if (!(availableSpecies().count(pk.species()) > 0) || pk.egg())
+        if (!legalityBits().hasSpecies(pk.species()) || pk.egg())
         {
             return;
         }
@@ -541,7 +589,9 @@ namespace pksm
             { // Already 2
                 LittleEndian::convertFrom<u32>(
                     &data[PokeDex + 0x8E8 + shift * 4], pk.encryptionConstant());
+                markDirty(PokeDex + 0x8E8 + shift * 4, sizeof(u32));
                 data[PokeDex + 0x84] |= (u8)(1 << shift);
+                markDirty(PokeDex + 0x84);
             }
             else if ((data[PokeDex + 0x84] & (1 << shift)) == 0)
             {                                             // Not yet 1
@@ -550,7 +600,9 @@ namespace pksm
         }
 
         int off        = PokeDex + 0x08 + 0x80;
+                markDirty(PokeDex + 0x84);
         data[off + bd] |= (1 << bm);
+        markDirty(off + bd);
 
         int formstart = pk.alternativeForm();
         int formend   = formstart;
@@ -597,6 +649,7 @@ namespace pksm
             if (lbit >> 3 < 920)
             {
                 data[PokeDexLanguageFlags + (lbit >> 3)] |= (u8)(1 << (lbit & 7));
+                markDirty(PokeDexLanguageFlags + (lbit >> 3));
             }
         }
     }
@@ -604,7 +657,7 @@ namespace pksm
     int SavLGPE::dexSeen(void) const
     {
         int ret = 0;
-        for (const auto& species : availableSpecies())
+        for (const auto& species : speciesList())
         {
             int forms = formCount(species);
             for (int form = 0; form < forms; form++)
@@ -632,7 +685,7 @@ namespace pksm
     int SavLGPE::dexCaught(void) const
     {
         int ret = 0;
-        for (const auto& species : availableSpecies())
+        for (const auto& species : speciesList())
         {
             if (data[PokeDex + 0x88 + (u16(species) - 1) / 8] & (1 << ((u16(species) - 1) % 8)))
             {
@@ -644,22 +697,21 @@ namespace pksm
 
     void SavLGPE::cryptBoxData(bool crypted)
     {
-        for (u8 box = 0; box < maxBoxes(); box++)
+        pksm::crypto::pkm::cryptBoxData(Generation::LGPE,
+            {&data[boxOffset(0, 0)], PB7::PARTY_LENGTH * maxSlot()}, PB7::PARTY_LENGTH, crypted);
+        markDirty(boxOffset(0, 0), PB7::PARTY_LENGTH * maxSlot());
+    }
+
+    bool SavLGPE::visitBoxSlots(SlotVisitor visitor, void* context) const
+    {
+        for (int i = 0; i < maxSlot(); i++)
         {
-            for (u8 slot = 0; slot < 30; slot++)
-            {
-                if (box * 30 + slot > 1000)
-                {
-                    return;
-                }
-                std::unique_ptr<PKX> pb7 = PKX::getPKM<Generation::LGPE>(
-                    &data[boxOffset(box, slot)], PB7::PARTY_LENGTH, true);
-                if (!crypted)
-                {
-                    pb7->encrypt();
-                }
-            }
+            u8 box  = i / 30;
+            u8 slot = i % 30;
+            visitBoxSlot(
+                visitor, context, box, slot, &data[boxOffset(box, slot)], PB7::PARTY_LENGTH);
         }
+        return true;
     }
 
     void SavLGPE::mysteryGift(const WCX& wc, int&)
@@ -898,36 +950,42 @@ namespace pksm
                 if (slot < 60)
                 {
                     std::copy(write.begin(), write.end(), &data[slot * 4]);
+                    markDirty(slot * 4, write.size());
                 }
                 break;
             case Pouch::TM:
                 if (slot < 108)
                 {
                     std::copy(write.begin(), write.end(), &data[0xF0 + slot * 4]);
+                    markDirty(0xF0 + slot * 4, write.size());
                 }
                 break;
             case Pouch::Candy:
                 if (slot < 200)
                 {
                     std::copy(write.begin(), write.end(), &data[0x2A0 + slot * 4]);
+                    markDirty(0x2A0 + slot * 4, write.size());
                 }
                 break;
             case Pouch::ZCrystals:
                 if (slot < 150)
                 {
                     std::copy(write.begin(), write.end(), &data[0x5C0 + slot * 4]);
+                    markDirty(0x5C0 + slot * 4, write.size());
                 }
                 break;
             case Pouch::CatchingItem:
                 if (slot < 50)
                 {
                     std::copy(write.begin(), write.end(), &data[0x818 + slot * 4]);
+                    markDirty(0x818 + slot * 4, write.size());
                 }
                 break;
             case Pouch::Battle:
                 if (slot < 150)
                 {
                     std::copy(write.begin(), write.end(), &data[0x8E0 + slot * 4]);
+                    markDirty(0x8E0 + slot * 4, write.size());
                 }
                 break;
             case Pouch::KeyItem:
@@ -935,6 +993,7 @@ namespace pksm
                 if (slot < 150)
                 {
                     std::copy(write.begin(), write.end(), &data[0xB38 + slot * 4]);
+                    markDirty(0xB38 + slot * 4, write.size());
                 }
                 break;
             default:
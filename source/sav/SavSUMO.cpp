@@ -53,6 +53,8 @@ namespace pksm
         PouchMedicine        = 0xB48;
         PouchBerry           = 0xC48;
         PouchZCrystals       = 0xD68;
+
+        trackChecksumBlocks(chkofs);
     }
 
     void SavSUMO::resign(void)
@@ -60,8 +62,13 @@ namespace pksm
         static constexpr u8 blockCount = 37;
         static constexpr u32 csoff     = 0x6BC1A;
 
+        const bool fullResign = allBlocksDirty();
         for (u8 i = 0; i < blockCount; i++)
         {
+            if (!blockDirty(i))
+            {
+                continue;
+            }
             // Clear memecrypto data
             if (LittleEndian::convertTo<u16>(&data[csoff + i * 8 - 2]) == 36)
             {
@@ -70,12 +77,23 @@ namespace pksm
             LittleEndian::convertFrom<u16>(
                 &data[csoff + i * 8], pksm::crypto::crc16({&data[chkofs[i]], chklen[i]}));
         }
+        clearDirty();
 
         static constexpr u32 checksumTableOffset = 0x6BC00;
         static constexpr u32 checksumTableLength = 0x140;
         static constexpr u32 memecryptoOffset    = 0x6BB00;
 
         auto hash = crypto::sha256({&data[checksumTableOffset], checksumTableLength});
+        // The signature only covers the checksum table
+        if (!fullResign && signedChecksumHash == hash)
+        {
+            return;
+        }
+        signedChecksumHash = hash;
+
+        // The memecrypto data is cleared before the block containing it is checksummed, which
+        // won't have happened if that block is clean
+        std::fill_n(&data[memecryptoOffset], 0x80, 0);
 
         u8 decryptedSignature[0x80];
         reverseCrypt(&data[memecryptoOffset], decryptedSignature);
@@ -26,6 +26,7 @@
 
 #include "sav/SavSV.hpp"
 #include "pkx/PK9.hpp"
+#include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/i18n.hpp"
 #include "utils/random.hpp"
@@ -200,118 +201,118 @@ namespace pksm
 
     u16 SavSV::TID(void) const
     {
-        return LittleEndian::convertTo<u16>(getBlock(Status)->decryptedData() + 0x00);
+        return LittleEndian::convertTo<u16>(rawBlock(Status)->decryptedData() + 0x00);
     }
 
     void SavSV::TID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(getBlock(Status)->decryptedData() + 0x00, v);
+        LittleEndian::convertFrom<u16>(rawBlock(Status)->decryptedData() + 0x00, v);
     }
 
     u16 SavSV::SID(void) const
     {
-        return LittleEndian::convertTo<u16>(getBlock(Status)->decryptedData() + 0x02);
+        return LittleEndian::convertTo<u16>(rawBlock(Status)->decryptedData() + 0x02);
     }
 
     void SavSV::SID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(getBlock(Status)->decryptedData() + 0x02, v);
+        LittleEndian::convertFrom<u16>(rawBlock(Status)->decryptedData() + 0x02, v);
     }
 
     GameVersion SavSV::version(void) const
     {
-        return GameVersion(getBlock(Status)->decryptedData()[0x04]);
+        return GameVersion(rawBlock(Status)->decryptedData()[0x04]);
     }
 
     void SavSV::version(GameVersion v)
     {
-        getBlock(Status)->decryptedData()[0x04] = u8(v);
+        rawBlock(Status)->decryptedData()[0x04] = u8(v);
     }
 
     Gender SavSV::gender(void) const
     {
-        return Gender{getBlock(Status)->decryptedData()[0x05]};
+        return Gender{rawBlock(Status)->decryptedData()[0x05]};
     }
 
     void SavSV::gender(Gender v)
     {
-        getBlock(Status)->decryptedData()[0x05] = u8(v);
+        rawBlock(Status)->decryptedData()[0x05] = u8(v);
     }
 
     Language SavSV::language(void) const
     {
-        return Language(getBlock(Status)->decryptedData()[0x07]);
+        return Language(rawBlock(Status)->decryptedData()[0x07]);
     }
 
     void SavSV::language(Language v)
     {
-        getBlock(Status)->decryptedData()[0x07] = u8(v);
+        rawBlock(Status)->decryptedData()[0x07] = u8(v);
     }
 
     std::string SavSV::otName(void) const
     {
-        return StringUtils::getString(getBlock(Status)->decryptedData(), 0x10, 13);
+        return StringUtils::getString(rawBlock(Status)->decryptedData(), 0x10, 13);
     }
 
     void SavSV::otName(const std::string_view& v)
     {
-        StringUtils::setString(getBlock(Status)->decryptedData(), v, 0x10, 13);
-        StringUtils::setString(getBlock(TrainerCard)->decryptedData(), v, 0, 13);
+        StringUtils::setString(rawBlock(Status)->decryptedData(), v, 0x10, 13);
+        StringUtils::setString(rawBlock(TrainerCard)->decryptedData(), v, 0, 13);
     }
 
     u32 SavSV::money(void) const
     {
-        return LittleEndian::convertTo<u32>(getBlock(Money)->decryptedData());
+        return LittleEndian::convertTo<u32>(rawBlock(Money)->decryptedData());
     }
 
     void SavSV::money(u32 v)
     {
-        LittleEndian::convertFrom<u32>(getBlock(Money)->decryptedData(), v);
+        LittleEndian::convertFrom<u32>(rawBlock(Money)->decryptedData(), v);
     }
 
     u32 SavSV::BP(void) const
     {
-        return LittleEndian::convertTo<u32>(getBlock(LP)->decryptedData());
+        return LittleEndian::convertTo<u32>(rawBlock(LP)->decryptedData());
     }
 
     void SavSV::BP(u32 v)
     {
-        LittleEndian::convertFrom<u32>(getBlock(LP)->decryptedData(), v);
+        LittleEndian::convertFrom<u32>(rawBlock(LP)->decryptedData(), v);
     }
 
     u8 SavSV::badges(void) const
     {
-        return getBlock(Money)->decryptedData()[0x11C];
+        return rawBlock(Money)->decryptedData()[0x11C];
     }
 
     u16 SavSV::playedHours(void) const
     {
-        return LittleEndian::convertTo<u16>(getBlock(PlayTime)->decryptedData());
+        return LittleEndian::convertTo<u16>(rawBlock(PlayTime)->decryptedData());
     }
 
     void SavSV::playedHours(u16 v)
     {
-        LittleEndian::convertFrom<u16>(getBlock(PlayTime)->decryptedData(), v);
+        LittleEndian::convertFrom<u16>(rawBlock(PlayTime)->decryptedData(), v);
     }
 
     u8 SavSV::playedMinutes(void) const
     {
-        return getBlock(PlayTime)->decryptedData()[4];
+        return rawBlock(PlayTime)->decryptedData()[4];
     }
 
     void SavSV::playedMinutes(u8 v)
     {
-        getBlock(PlayTime)->decryptedData()[4] = v;
+        rawBlock(PlayTime)->decryptedData()[4] = v;
     }
 
     u8 SavSV::playedSeconds(void) const
     {
-        return getBlock(PlayTime)->decryptedData()[8];
+        return rawBlock(PlayTime)->decryptedData()[8];
     }
 
     void SavSV::playedSeconds(u8 v)
     {
-        getBlock(PlayTime)->decryptedData()[8] = v;
+        rawBlock(PlayTime)->decryptedData()[8] = v;
     }
 
     void SavSV::item(const Item& item, Pouch pouch, u16 slot)
@@ -321,39 +322,39 @@ namespace pksm
         switch (pouch)
         {
             case Pouch::Medicine:
-                std::copy(write.begin(), write.end(), getBlock(Items)->decryptedData() + 4 * slot);
+                std::copy(write.begin(), write.end(), rawBlock(Items)->decryptedData() + 4 * slot);
                 break;
             case Pouch::Ball:
                 std::copy(
-                    write.begin(), write.end(), getBlock(Items)->decryptedData() + 0xF0 + 4 * slot);
+                    write.begin(), write.end(), rawBlock(Items)->decryptedData() + 0xF0 + 4 * slot);
                 break;
             case Pouch::Battle:
                 std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x168 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0x168 + 4 * slot);
                 break;
             case Pouch::Berry:
                 std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x1B8 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0x1B8 + 4 * slot);
                 break;
             case Pouch::NormalItem:
                 std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x2F8 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0x2F8 + 4 * slot);
                 break;
             case Pouch::TM:
                 std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0xB90 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0xB90 + 4 * slot);
                 break;
             case Pouch::Treasure:
                 std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0xED8 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0xED8 + 4 * slot);
                 break;
             case Pouch::Ingredient:
                 std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x1068 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0x1068 + 4 * slot);
                 break;
             case Pouch::KeyItem:
                 std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x11F8 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0x11F8 + 4 * slot);
                 break;
             default:
                 break;
@@ -365,25 +366,25 @@ namespace pksm
         switch (pouch)
         {
             case Pouch::Medicine:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 4 * slot);
+                return std::make_unique<Item8>(rawBlock(Items)->decryptedData() + 4 * slot);
             case Pouch::Ball:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0xF0 + 4 * slot);
+                return std::make_unique<Item8>(rawBlock(Items)->decryptedData() + 0xF0 + 4 * slot);
             case Pouch::Battle:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0x168 + 4 * slot);
+                return std::make_unique<Item8>(rawBlock(Items)->decryptedData() + 0x168 + 4 * slot);
             case Pouch::Berry:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0x1B8 + 4 * slot);
+                return std::make_unique<Item8>(rawBlock(Items)->decryptedData() + 0x1B8 + 4 * slot);
             case Pouch::NormalItem:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0x2F8 + 4 * slot);
+                return std::make_unique<Item8>(rawBlock(Items)->decryptedData() + 0x2F8 + 4 * slot);
             case Pouch::TM:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0xB90 + 4 * slot);
+                return std::make_unique<Item8>(rawBlock(Items)->decryptedData() + 0xB90 + 4 * slot);
             case Pouch::Treasure:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0xED8 + 4 * slot);
+                return std::make_unique<Item8>(rawBlock(Items)->decryptedData() + 0xED8 + 4 * slot);
             case Pouch::Ingredient:
                 return std::make_unique<Item8>(
-                    getBlock(Items)->decryptedData() + 0x1068 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0x1068 + 4 * slot);
             case Pouch::KeyItem:
                 return std::make_unique<Item8>(
-                    getBlock(Items)->decryptedData() + 0x11F8 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0x11F8 + 4 * slot);
             default:
                 return std::make_unique<Item8>();
         }
@@ -499,32 +500,32 @@ namespace pksm
 
     u8 SavSV::currentBox() const
     {
-        return LittleEndian::convertTo<u32>(getBlock(0x017C3CBB)->decryptedData());
+        return LittleEndian::convertTo<u32>(rawBlock(0x017C3CBB)->decryptedData());
     }
 
     void SavSV::currentBox(u8 box)
     {
-        LittleEndian::convertFrom<u32>(getBlock(0x017C3CBB)->decryptedData(), box);
+        LittleEndian::convertFrom<u32>(rawBlock(0x017C3CBB)->decryptedData(), box);
     }
 
     std::string SavSV::boxName(u8 box) const
     {
-        return StringUtils::getString(getBlock(BoxLayout)->decryptedData(), box * 0x22, 17);
+        return StringUtils::getString(rawBlock(BoxLayout)->decryptedData(), box * 0x22, 17);
     }
 
     void SavSV::boxName(u8 box, const std::string_view& name)
     {
-        StringUtils::setString(getBlock(BoxLayout)->decryptedData(), name, box * 0x22, 17);
+        StringUtils::setString(rawBlock(BoxLayout)->decryptedData(), name, box * 0x22, 17);
     }
 
     u8 SavSV::boxWallpaper(u8 box) const
     {
-        return LittleEndian::convertTo<u32>(getBlock(0x017C3CBB)->decryptedData() + box * 4);
+        return LittleEndian::convertTo<u32>(rawBlock(0x017C3CBB)->decryptedData() + box * 4);
     }
 
     void SavSV::boxWallpaper(u8 box, u8 v)
     {
-        LittleEndian::convertFrom<u32>(getBlock(0x2EB1B190)->decryptedData() + box * 4, v);
+        LittleEndian::convertFrom<u32>(rawBlock(0x2EB1B190)->decryptedData() + box * 4, v);
     }
 
     u32 SavSV::boxOffset(u8 box, u8 slot) const
@@ -539,26 +540,38 @@ namespace pksm
 
     u8 SavSV::partyCount(void) const
     {
-        return getBlock(Party)->decryptedData()[PK9::PARTY_LENGTH * 6];
+        return rawBlock(Party)->decryptedData()[PK9::PARTY_LENGTH * 6];
     }
 
     void SavSV::partyCount(u8 count)
     {
-        getBlock(Party)->decryptedData()[PK9::PARTY_LENGTH * 6] = count;
+        rawBlock(Party)->decryptedData()[PK9::PARTY_LENGTH * 6] = count;
     }
 
     std::unique_ptr<PKX> SavSV::pkm(u8 slot) const
     {
         u32 offset = partyOffset(slot);
         return PKX::getPKM<Generation::NINE>(
-            getBlock(Party)->decryptedData() + offset, PK9::PARTY_LENGTH);
+            rawBlock(Party)->decryptedData() + offset, PK9::PARTY_LENGTH);
     }
 
     std::unique_ptr<PKX> SavSV::pkm(u8 box, u8 slot) const
     {
         u32 offset = boxOffset(box, slot);
         return PKX::getPKM<Generation::NINE>(
-            getBlock(Box)->decryptedData() + offset, PK9::PARTY_LENGTH);
+            rawBlock(Box)->decryptedData() + offset, PK9::PARTY_LENGTH);
+    }
+
+    bool SavSV::pkmInto(PKX& out, u8 slot) const
+    {
+        return PKX::getPKM<Generation::NINE>(
+            out, rawBlock(Party)->decryptedData() + partyOffset(slot), PK9::PARTY_LENGTH);
+    }
+
+    bool SavSV::pkmInto(PKX& out, u8 box, u8 slot) const
+    {
+        return PKX::getPKM<Generation::NINE>(
+            out, rawBlock(Box)->decryptedData() + boxOffset(box, slot), PK9::PARTY_LENGTH);
     }
 
     void SavSV::pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)
@@ -572,7 +585,8 @@ namespace pksm
             }
 
             std::ranges::copy(
-                pk8->rawData(), getBlock(Box)->decryptedData() + boxOffset(box, slot));
+                pk8->rawData(), rawBlock(Box)->decryptedData() + boxOffset(box, slot));
+            boxSlotWritten(*pk8, box, slot);
         }
     }
 
@@ -582,24 +596,29 @@ namespace pksm
         {
             auto pk8 = pk.partyClone();
             pk8->encrypt();
-            std::ranges::copy(pk8->rawData(), getBlock(Party)->decryptedData() + partyOffset(slot));
+            std::ranges::copy(pk8->rawData(), rawBlock(Party)->decryptedData() + partyOffset(slot));
         }
     }
 
     void SavSV::cryptBoxData(bool crypted)
     {
+        pksm::crypto::pkm::cryptBoxData(Generation::NINE,
+            {rawBlock(Box)->decryptedData(), PK9::PARTY_LENGTH * 30 * maxBoxes()},
+            PK9::PARTY_LENGTH, crypted);
+    }
+
+    bool SavSV::visitBoxSlots(SlotVisitor visitor, void* context) const
+    {
+        const u8* boxData = rawBlock(Box)->decryptedData();
         for (u8 box = 0; box < maxBoxes(); box++)
         {
             for (u8 slot = 0; slot < 30; slot++)
             {
-                std::unique_ptr<PKX> pk8 = PKX::getPKM<Generation::NINE>(
-                    getBlock(Box)->decryptedData() + boxOffset(box, slot), PK9::PARTY_LENGTH, true);
-                if (!crypted)
-                {
-                    pk8->encrypt();
-                }
+                visitBoxSlot(visitor, context, box, slot, boxData + boxOffset(box, slot),
+                    PK9::PARTY_LENGTH);
             }
         }
+        return true;
     }
 
     void SavSV::mysteryGift(const WCX& wc, int&)
@@ -609,17 +628,10 @@ namespace pksm
             const WC8& wc8 = static_cast<const WC8&>(wc);
             if (wc8.pokemon())
             {
-                int injectPosition = 0;
-                for (injectPosition = 0; injectPosition < maxSlot(); injectPosition++)
-                {
-                    if (pkm(injectPosition / 30, injectPosition % 30)->species() == Species::None)
-                    {
-                        break;
-                    }
-                }
+                int injectPosition = firstFreeSlot();
 
                 // No place to put generated PK9!
-                if (injectPosition == maxSlot())
+                if (injectPosition < 0)
                 {
                     return;
                 }
@@ -895,7 +907,7 @@ namespace pksm
         {
             if (u16 index = ((PK9&)pk).pokedexIndex())
             {
-                entryAddr = getBlock(PokeDex)->decryptedData() + sizeof(DexEntry) * (index - 1);
+                entryAddr = rawBlock(PokeDex)->decryptedData() + sizeof(DexEntry) * (index - 1);
             }
         }
 
@@ -933,10 +945,10 @@ namespace pksm
     int SavSV::dexSeen() const
     {
         int ret = 0;
-        for (const auto& i : availableSpecies())
+        for (const auto& i : speciesList())
         {
             u16 index       = PersonalSWSH::pokedexIndex(u16(i));
-            u8* entryOffset = getBlock(PokeDex)->decryptedData() + index * sizeof(DexEntry);
+            u8* entryOffset = rawBlock(PokeDex)->decryptedData() + index * sizeof(DexEntry);
             for (size_t j = 0; j < 0x20; j++) // Entire seen region size
             {
                 if (entryOffset[j])
@@ -952,10 +964,10 @@ namespace pksm
     int SavSV::dexCaught() const
     {
         int ret = 0;
-        for (const auto& i : availableSpecies())
+        for (const auto& i : speciesList())
         {
             u16 index       = PersonalSWSH::pokedexIndex(u16(i));
-            u8* entryOffset = getBlock(PokeDex)->decryptedData() + index * sizeof(DexEntry);
+            u8* entryOffset = rawBlock(PokeDex)->decryptedData() + index * sizeof(DexEntry);
             if (entryOffset[0x20] & 3)
             {
                 ret++;
@@ -26,6 +26,7 @@
 
 #include "sav/SavSWSH.hpp"
 #include "pkx/PK8.hpp"
+#include "utils/crypto.hpp"
 #include "utils/endian.hpp"
 #include "utils/i18n.hpp"
 #include "utils/random.hpp"
@@ -202,133 +203,133 @@ namespace pksm
 
     u16 SavSWSH::TID(void) const
     {
-        return LittleEndian::convertTo<u16>(getBlock(Status)->decryptedData() + 0xA0);
+        return LittleEndian::convertTo<u16>(rawBlock(Status)->decryptedData() + 0xA0);
     }
 
     void SavSWSH::TID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(getBlock(Status)->decryptedData() + 0xA0, v);
-        LittleEndian::convertFrom<u32>(getBlock(TrainerCard)->decryptedData() + 0x1C, displayTID());
+        LittleEndian::convertFrom<u16>(rawBlock(Status)->decryptedData() + 0xA0, v);
+        LittleEndian::convertFrom<u32>(rawBlock(TrainerCard)->decryptedData() + 0x1C, displayTID());
     }
 
     u16 SavSWSH::SID(void) const
     {
-        return LittleEndian::convertTo<u16>(getBlock(Status)->decryptedData() + 0xA2);
+        return LittleEndian::convertTo<u16>(rawBlock(Status)->decryptedData() + 0xA2);
     }
 
     void SavSWSH::SID(u16 v)
     {
-        LittleEndian::convertFrom<u16>(getBlock(Status)->decryptedData() + 0xA2, v);
-        LittleEndian::convertFrom<u32>(getBlock(TrainerCard)->decryptedData() + 0x1C, displayTID());
+        LittleEndian::convertFrom<u16>(rawBlock(Status)->decryptedData() + 0xA2, v);
+        LittleEndian::convertFrom<u32>(rawBlock(TrainerCard)->decryptedData() + 0x1C, displayTID());
     }
 
     GameVersion SavSWSH::version(void) const
     {
-        return GameVersion(getBlock(Status)->decryptedData()[0xA4]);
+        return GameVersion(rawBlock(Status)->decryptedData()[0xA4]);
     }
 
     void SavSWSH::version(GameVersion v)
     {
-        getBlock(Status)->decryptedData()[0xA4] = u8(v);
+        rawBlock(Status)->decryptedData()[0xA4] = u8(v);
     }
 
     Gender SavSWSH::gender(void) const
     {
-        return Gender{getBlock(Status)->decryptedData()[0xA5]};
+        return Gender{rawBlock(Status)->decryptedData()[0xA5]};
     }
 
     void SavSWSH::gender(Gender v)
     {
-        getBlock(Status)->decryptedData()[0xA5] = u8(v);
+        rawBlock(Status)->decryptedData()[0xA5] = u8(v);
     }
 
     Language SavSWSH::language(void) const
     {
-        return Language(getBlock(Status)->decryptedData()[0xA7]);
+        return Language(rawBlock(Status)->decryptedData()[0xA7]);
     }
 
     void SavSWSH::language(Language v)
     {
-        getBlock(Status)->decryptedData()[0xA7] = u8(v);
+        rawBlock(Status)->decryptedData()[0xA7] = u8(v);
     }
 
     std::string SavSWSH::otName(void) const
     {
-        return StringUtils::getString(getBlock(Status)->decryptedData(), 0xB0, 13);
+        return StringUtils::getString(rawBlock(Status)->decryptedData(), 0xB0, 13);
     }
 
     void SavSWSH::otName(const std::string_view& v)
     {
-        StringUtils::setString(getBlock(Status)->decryptedData(), v, 0xB0, 13);
-        StringUtils::setString(getBlock(TrainerCard)->decryptedData(), v, 0, 13);
+        StringUtils::setString(rawBlock(Status)->decryptedData(), v, 0xB0, 13);
+        StringUtils::setString(rawBlock(TrainerCard)->decryptedData(), v, 0, 13);
     }
 
     std::string SavSWSH::jerseyNum(void) const
     {
-        return std::string((char*)getBlock(TrainerCard)->decryptedData() + 0x39, 3);
+        return std::string((char*)rawBlock(TrainerCard)->decryptedData() + 0x39, 3);
     }
 
     void SavSWSH::jerseyNum(const std::string_view& v)
     {
         for (size_t i = 0; i < std::min(v.size(), (size_t)3); i++)
         {
-            getBlock(TrainerCard)->decryptedData()[0x39 + i] = v[i];
+            rawBlock(TrainerCard)->decryptedData()[0x39 + i] = v[i];
         }
     }
 
     u32 SavSWSH::money(void) const
     {
-        return LittleEndian::convertTo<u32>(getBlock(Misc)->decryptedData());
+        return LittleEndian::convertTo<u32>(rawBlock(Misc)->decryptedData());
     }
 
     void SavSWSH::money(u32 v)
     {
-        LittleEndian::convertFrom<u32>(getBlock(Misc)->decryptedData(), v);
+        LittleEndian::convertFrom<u32>(rawBlock(Misc)->decryptedData(), v);
     }
 
     u32 SavSWSH::BP(void) const
     {
-        return LittleEndian::convertTo<u32>(getBlock(Misc)->decryptedData() + 4);
+        return LittleEndian::convertTo<u32>(rawBlock(Misc)->decryptedData() + 4);
     }
 
     void SavSWSH::BP(u32 v)
     {
-        LittleEndian::convertFrom<u32>(getBlock(Misc)->decryptedData() + 4, v);
+        LittleEndian::convertFrom<u32>(rawBlock(Misc)->decryptedData() + 4, v);
     }
 
     u8 SavSWSH::badges(void) const
     {
-        return getBlock(Misc)->decryptedData()[0x11C];
+        return rawBlock(Misc)->decryptedData()[0x11C];
     }
 
     u16 SavSWSH::playedHours(void) const
     {
-        return LittleEndian::convertTo<u16>(getBlock(PlayTime)->decryptedData());
+        return LittleEndian::convertTo<u16>(rawBlock(PlayTime)->decryptedData());
     }
 
     void SavSWSH::playedHours(u16 v)
     {
-        LittleEndian::convertFrom<u16>(getBlock(PlayTime)->decryptedData(), v);
+        LittleEndian::convertFrom<u16>(rawBlock(PlayTime)->decryptedData(), v);
     }
 
     u8 SavSWSH::playedMinutes(void) const
     {
-        return getBlock(PlayTime)->decryptedData()[2];
+        return rawBlock(PlayTime)->decryptedData()[2];
     }
 
     void SavSWSH::playedMinutes(u8 v)
     {
-        getBlock(PlayTime)->decryptedData()[2] = v;
+        rawBlock(PlayTime)->decryptedData()[2] = v;
     }
 
     u8 SavSWSH::playedSeconds(void) const
     {
-        return getBlock(PlayTime)->decryptedData()[3];
+        return rawBlock(PlayTime)->decryptedData()[3];
     }
 
     void SavSWSH::playedSeconds(u8 v)
     {
-        getBlock(PlayTime)->decryptedData()[3] = v;
+        rawBlock(PlayTime)->decryptedData()[3] = v;
     }
 
     void SavSWSH::item(const Item& item, Pouch pouch, u16 slot)
@@ -338,39 +339,39 @@ namespace pksm
         switch (pouch)
         {
             case Pouch::Medicine:
-                std::copy(write.begin(), write.end(), getBlock(Items)->decryptedData() + 4 * slot);
+                std::copy(write.begin(), write.end(), rawBlock(Items)->decryptedData() + 4 * slot);
                 break;
             case Pouch::Ball:
                 std::copy(
-                    write.begin(), write.end(), getBlock(Items)->decryptedData() + 0xF0 + 4 * slot);
+                    write.begin(), write.end(), rawBlock(Items)->decryptedData() + 0xF0 + 4 * slot);
                 break;
             case Pouch::Battle:
                 std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x168 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0x168 + 4 * slot);
                 break;
             case Pouch::Berry:
                 std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x1B8 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0x1B8 + 4 * slot);
                 break;
             case Pouch::NormalItem:
                 std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x2F8 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0x2F8 + 4 * slot);
                 break;
             case Pouch::TM:
                 std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0xB90 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0xB90 + 4 * slot);
                 break;
             case Pouch::Treasure:
                 std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0xED8 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0xED8 + 4 * slot);
                 break;
             case Pouch::Ingredient:
                 std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x1068 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0x1068 + 4 * slot);
                 break;
             case Pouch::KeyItem:
                 std::copy(write.begin(), write.end(),
-                    getBlock(Items)->decryptedData() + 0x11F8 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0x11F8 + 4 * slot);
                 break;
             default:
                 break;
@@ -382,25 +383,25 @@ namespace pksm
         switch (pouch)
         {
             case Pouch::Medicine:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 4 * slot);
+                return std::make_unique<Item8>(rawBlock(Items)->decryptedData() + 4 * slot);
             case Pouch::Ball:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0xF0 + 4 * slot);
+                return std::make_unique<Item8>(rawBlock(Items)->decryptedData() + 0xF0 + 4 * slot);
             case Pouch::Battle:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0x168 + 4 * slot);
+                return std::make_unique<Item8>(rawBlock(Items)->decryptedData() + 0x168 + 4 * slot);
             case Pouch::Berry:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0x1B8 + 4 * slot);
+                return std::make_unique<Item8>(rawBlock(Items)->decryptedData() + 0x1B8 + 4 * slot);
             case Pouch::NormalItem:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0x2F8 + 4 * slot);
+                return std::make_unique<Item8>(rawBlock(Items)->decryptedData() + 0x2F8 + 4 * slot);
             case Pouch::TM:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0xB90 + 4 * slot);
+                return std::make_unique<Item8>(rawBlock(Items)->decryptedData() + 0xB90 + 4 * slot);
             case Pouch::Treasure:
-                return std::make_unique<Item8>(getBlock(Items)->decryptedData() + 0xED8 + 4 * slot);
+                return std::make_unique<Item8>(rawBlock(Items)->decryptedData() + 0xED8 + 4 * slot);
             case Pouch::Ingredient:
                 return std::make_unique<Item8>(
-                    getBlock(Items)->decryptedData() + 0x1068 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0x1068 + 4 * slot);
             case Pouch::KeyItem:
                 return std::make_unique<Item8>(
-                    getBlock(Items)->decryptedData() + 0x11F8 + 4 * slot);
+                    rawBlock(Items)->decryptedData() + 0x11F8 + 4 * slot);
             default:
                 return std::make_unique<Item8>();
         }
@@ -516,32 +517,32 @@ namespace pksm
 
     u8 SavSWSH::currentBox() const
     {
-        return LittleEndian::convertTo<u32>(getBlock(0x017C3CBB)->decryptedData());
+        return LittleEndian::convertTo<u32>(rawBlock(0x017C3CBB)->decryptedData());
     }
 
     void SavSWSH::currentBox(u8 box)
     {
-        LittleEndian::convertFrom<u32>(getBlock(0x017C3CBB)->decryptedData(), box);
+        LittleEndian::convertFrom<u32>(rawBlock(0x017C3CBB)->decryptedData(), box);
     }
 
     std::string SavSWSH::boxName(u8 box) const
     {
-        return StringUtils::getString(getBlock(BoxLayout)->decryptedData(), box * 0x22, 17);
+        return StringUtils::getString(rawBlock(BoxLayout)->decryptedData(), box * 0x22, 17);
     }
 
     void SavSWSH::boxName(u8 box, const std::string_view& name)
     {
-        StringUtils::setString(getBlock(BoxLayout)->decryptedData(), name, box * 0x22, 17);
+        StringUtils::setString(rawBlock(BoxLayout)->decryptedData(), name, box * 0x22, 17);
     }
 
     u8 SavSWSH::boxWallpaper(u8 box) const
     {
-        return LittleEndian::convertTo<u32>(getBlock(0x017C3CBB)->decryptedData() + box * 4);
+        return LittleEndian::convertTo<u32>(rawBlock(0x017C3CBB)->decryptedData() + box * 4);
     }
 
     void SavSWSH::boxWallpaper(u8 box, u8 v)
     {
-        LittleEndian::convertFrom<u32>(getBlock(0x2EB1B190)->decryptedData() + box * 4, v);
+        LittleEndian::convertFrom<u32>(rawBlock(0x2EB1B190)->decryptedData() + box * 4, v);
     }
 
     u32 SavSWSH::boxOffset(u8 box, u8 slot) const
@@ -556,26 +557,38 @@ namespace pksm
 
     u8 SavSWSH::partyCount(void) const
     {
-        return getBlock(Party)->decryptedData()[PK8::PARTY_LENGTH * 6];
+        return rawBlock(Party)->decryptedData()[PK8::PARTY_LENGTH * 6];
     }
 
     void SavSWSH::partyCount(u8 count)
     {
-        getBlock(Party)->decryptedData()[PK8::PARTY_LENGTH * 6] = count;
+        rawBlock(Party)->decryptedData()[PK8::PARTY_LENGTH * 6] = count;
     }
 
     std::unique_ptr<PKX> SavSWSH::pkm(u8 slot) const
     {
         u32 offset = partyOffset(slot);
         return PKX::getPKM<Generation::EIGHT>(
-            getBlock(Party)->decryptedData() + offset, PK8::PARTY_LENGTH);
+            rawBlock(Party)->decryptedData() + offset, PK8::PARTY_LENGTH);
     }
 
     std::unique_ptr<PKX> SavSWSH::pkm(u8 box, u8 slot) const
     {
         u32 offset = boxOffset(box, slot);
         return PKX::getPKM<Generation::EIGHT>(
-            getBlock(Box)->decryptedData() + offset, PK8::PARTY_LENGTH);
+            rawBlock(Box)->decryptedData() + offset, PK8::PARTY_LENGTH);
+    }
+
+    bool SavSWSH::pkmInto(PKX& out, u8 slot) const
+    {
+        return PKX::getPKM<Generation::EIGHT>(
+            out, rawBlock(Party)->decryptedData() + partyOffset(slot), PK8::PARTY_LENGTH);
+    }
+
+    bool SavSWSH::pkmInto(PKX& out, u8 box, u8 slot) const
+    {
+        return PKX::getPKM<Generation::EIGHT>(
+            out, rawBlock(Box)->decryptedData() + boxOffset(box, slot), PK8::PARTY_LENGTH);
     }
 
     void SavSWSH::pkm(const PKX& pk, u8 box, u8 slot, bool applyTrade)
@@ -589,7 +602,8 @@ namespace pksm
             }
 
             std::ranges::copy(
-                pk8->rawData(), getBlock(Box)->decryptedData() + boxOffset(box, slot));
+                pk8->rawData(), rawBlock(Box)->decryptedData() + boxOffset(box, slot));
+            boxSlotWritten(*pk8, box, slot);
         }
     }
 
@@ -599,24 +613,29 @@ namespace pksm
         {
             auto pk8 = pk.partyClone();
             pk8->encrypt();
-            std::ranges::copy(pk8->rawData(), getBlock(Party)->decryptedData() + partyOffset(slot));
+            std::ranges::copy(pk8->rawData(), rawBlock(Party)->decryptedData() + partyOffset(slot));
         }
     }
 
     void SavSWSH::cryptBoxData(bool crypted)
     {
+        pksm::crypto::pkm::cryptBoxData(Generation::EIGHT,
+            {rawBlock(Box)->decryptedData(), PK8::PARTY_LENGTH * 30 * maxBoxes()},
+            PK8::PARTY_LENGTH, crypted);
+    }
+
+    bool SavSWSH::visitBoxSlots(SlotVisitor visitor, void* context) const
+    {
+        const u8* boxData = rawBlock(Box)->decryptedData();
         for (u8 box = 0; box < maxBoxes(); box++)
         {
             for (u8 slot = 0; slot < 30; slot++)
             {
-                std::unique_ptr<PKX> pk8 = PKX::getPKM<Generation::EIGHT>(
-                    getBlock(Box)->decryptedData() + boxOffset(box, slot), PK8::PARTY_LENGTH, true);
-                if (!crypted)
-                {
-                    pk8->encrypt();
-                }
+                visitBoxSlot(visitor, context, box, slot, boxData + boxOffset(box, slot),
+                    PK8::PARTY_LENGTH);
             }
         }
+        return true;
     }
 
     void SavSWSH::mysteryGift(const WCX& wc, int&)
@@ -626,17 +645,10 @@ namespace pksm
             const WC8& wc8 = static_cast<const WC8&>(wc);
             if (wc8.pokemon())
             {
-                int injectPosition = 0;
-                for (injectPosition = 0; injectPosition < maxSlot(); injectPosition++)
-                {
-                    if (pkm(injectPosition / 30, injectPosition % 30)->species() == Species::None)
-                    {
-                        break;
-                    }
-                }
+                int injectPosition = firstFreeSlot();
 
                 // No place to put generated PK8!
-                if (injectPosition == maxSlot())
+                if (injectPosition < 0)
                 {
                     return;
                 }
@@ -912,15 +924,15 @@ namespace pksm
         {
             if (u16 index = ((PK8&)pk).pokedexIndex())
             {
-                entryAddr = getBlock(PokeDex)->decryptedData() + sizeof(DexEntry) * (index - 1);
+                entryAddr = rawBlock(PokeDex)->decryptedData() + sizeof(DexEntry) * (index - 1);
             }
             else if (u16 index = static_cast<const PK8&>(pk).armordexIndex())
             {
-                entryAddr = getBlock(ArmorDex)->decryptedData() + sizeof(DexEntry) * (index - 1);
+                entryAddr = rawBlock(ArmorDex)->decryptedData() + sizeof(DexEntry) * (index - 1);
             }
             else if (u16 index = static_cast<const PK8&>(pk).crowndexIndex())
             {
-                entryAddr = getBlock(CrownDex)->decryptedData() + sizeof(DexEntry) * (index - 1);
+                entryAddr = rawBlock(CrownDex)->decryptedData() + sizeof(DexEntry) * (index - 1);
             }
         }
 
@@ -958,10 +970,10 @@ namespace pksm
     int SavSWSH::dexSeen() const
     {
         int ret = 0;
-        for (const auto& i : availableSpecies())
+        for (const auto& i : speciesList())
         {
             u16 index       = PersonalSWSH::pokedexIndex(u16(i));
-            u8* entryOffset = getBlock(PokeDex)->decryptedData() + index * sizeof(DexEntry);
+            u8* entryOffset = rawBlock(PokeDex)->decryptedData() + index * sizeof(DexEntry);
             for (size_t j = 0; j < 0x20; j++) // Entire seen region size
             {
                 if (entryOffset[j])
@@ -977,10 +989,10 @@ namespace pksm
     int SavSWSH::dexCaught() const
     {
         int ret = 0;
-        for (const auto& i : availableSpecies())
+        for (const auto& i : speciesList())
         {
             u16 index       = PersonalSWSH::pokedexIndex(u16(i));
-            u8* entryOffset = getBlock(PokeDex)->decryptedData() + index * sizeof(DexEntry);
+            u8* entryOffset = rawBlock(PokeDex)->decryptedData() + index * sizeof(DexEntry);
             if (entryOffset[0x20] & 3)
             {
                 ret++;
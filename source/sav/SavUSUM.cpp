@@ -54,6 +54,8 @@ namespace pksm
         PouchBerry           = 0xC64;
         PouchZCrystals       = 0xD70;
         BattleItems          = 0xDFC;
+
+        trackChecksumBlocks(chkofs);
     }
 
     void SavUSUM::resign(void)
@@ -61,8 +63,13 @@ namespace pksm
         static constexpr u8 blockCount = 39;
         static constexpr u32 csoff     = 0x6CA1A;
 
+        const bool fullResign = allBlocksDirty();
         for (u8 i = 0; i < blockCount; i++)
         {
+            if (!blockDirty(i))
+            {
+                continue;
+            }
             // Clear memecrypto data
             if (LittleEndian::convertTo<u16>(&data[csoff + i * 8 - 2]) == 36)
             {
@@ -71,12 +78,23 @@ namespace pksm
             LittleEndian::convertFrom<u16>(
                 &data[csoff + i * 8], pksm::crypto::crc16({&data[chkofs[i]], chklen[i]}));
         }
+        clearDirty();
 
         const u32 checksumTableOffset = 0x6CA00;
         const u32 checksumTableLength = 0x150;
         const u32 memecryptoOffset    = 0x6C100;
 
         auto hash = crypto::sha256({&data[checksumTableOffset], checksumTableLength});
+        // The signature only covers the checksum table
+        if (!fullResign && signedChecksumHash == hash)
+        {
+            return;
+        }
+        signedChecksumHash = hash;
+
+        // The memecrypto data is cleared before the block containing it is checksummed, which
+        // won't have happened if that block is clean
+        std::fill_n(&data[memecryptoOffset], 0x80, 0);
 
         u8 decryptedSignature[0x80];
         reverseCrypt(&data[memecryptoOffset], decryptedSignature);
@@ -52,6 +52,8 @@ namespace pksm
         PouchTMHM            = 0xBC0;
         PouchMedicine        = 0xD68;
         PouchBerry           = 0xE68;
+
+        trackChecksumBlocks(chkofs);
     }
 
     void SavXY::resign(void)
@@ -61,9 +63,13 @@ namespace pksm
 
         for (u8 i = 0; i < blockCount; i++)
         {
-            LittleEndian::convertFrom<u16>(
-                &data[csoff + i * 8], pksm::crypto::ccitt16({&data[chkofs[i]], chklen[i]}));
+            if (blockDirty(i))
+            {
+                LittleEndian::convertFrom<u16>(
+                    &data[csoff + i * 8], pksm::crypto::ccitt16({&data[chkofs[i]], chklen[i]}));
+            }
         }
+        clearDirty();
     }
 
     std::map<Sav::Pouch, std::vector<int>> SavXY::validItems() const
@@ -0,0 +1,147 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "sav/SaveIngest.hpp"
+#include "sav/Sav.hpp"
+#include "utils/io.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+#ifndef _PKSMCORE_CONFIGURED
+#include "PKSMCORE_CONFIG.h"
+#endif
+
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+#include <thread>
+#endif
+
+namespace pksm
+{
+    SaveIngest::Error SaveIngest::ingest(
+        const Input& input, size_t index, const EntryCallback& onEntry)
+    {
+        std::shared_ptr<u8[]> data = input.data;
+        size_t length              = input.length;
+        if (!data)
+        {
+            data = io::mapFile(input.path, length);
+            if (!data)
+            {
+                return Error::READ;
+            }
+        }
+
+        std::unique_ptr<Sav> save;
+        try
+        {
+            save = Sav::getSave(data, length);
+        }
+        catch (const std::exception&)
+        {
+            return Error::DECODE;
+        }
+        if (!save)
+        {
+            return Error::UNKNOWN_FORMAT;
+        }
+
+        try
+        {
+            for (u8 slot = 0; slot < std::min<int>(save->partyCount(), 6); slot++)
+            {
+                Entry entry{index, -1, slot, save->pkm(slot)};
+                if (entry.pkm && entry.pkm->species() != Species::None)
+                {
+                    onEntry(entry);
+                }
+            }
+
+            for (int box = 0; box < save->maxBoxes(); box++)
+            {
+                for (u8 slot = 0; slot < 30 && box * 30 + slot < save->maxSlot(); slot++)
+                {
+                    Entry entry{index, box, slot, save->pkm(box, slot)};
+                    if (entry.pkm && entry.pkm->species() != Species::None)
+                    {
+                        onEntry(entry);
+                    }
+                }
+            }
+        }
+        catch (const std::exception&)
+        {
+            return Error::DECODE;
+        }
+
+        return Error::OKAY;
+    }
+
+    std::vector<SaveIngest::Error> SaveIngest::run(std::span<const Input> inputs,
+        const EntryCallback& onEntry, const DoneCallback& onDone, unsigned int threads)
+    {
+        std::vector<Error> ret(inputs.size(), Error::OKAY);
+
+        // Saves are independent and vary wildly in cost, so workers claim the next unstarted one
+        // instead of being handed fixed ranges up front
+        std::atomic<size_t> next = 0;
+        auto worker              = [&]()
+        {
+            for (size_t i = next++; i < inputs.size(); i = next++)
+            {
+                ret[i] = ingest(inputs[i], i, onEntry);
+                if (onDone)
+                {
+                    onDone(i, ret[i]);
+                }
+            }
+        };
+
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+        (void)threads;
+        worker();
+#else
+        if (threads == 0)
+        {
+            threads = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        threads = std::min<size_t>(threads, inputs.size());
+
+        std::vector<std::thread> pool;
+        for (unsigned int i = 1; i < threads; i++)
+        {
+            pool.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : pool)
+        {
+            thread.join();
+        }
+#endif
+
+        return ret;
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "sav/SlotIndex.hpp"
+#include <algorithm>
+
+namespace
+{
+    template <typename Map, typename K>
+    std::span<const pksm::SlotIndex::Slot> find_slots(const Map& map, const K& key)
+    {
+        auto found = map.find(key);
+        if (found == map.end())
+        {
+            return {};
+        }
+        return found->second;
+    }
+
+    void erase_slot(std::vector<pksm::SlotIndex::Slot>& slots, const pksm::SlotIndex::Slot& slot)
+    {
+        // Erased rather than swapped out so that a freshly built index stays in slot order
+        auto found = std::ranges::find(slots, slot);
+        if (found != slots.end())
+        {
+            slots.erase(found);
+        }
+    }
+
+    u32 species_key(pksm::Species species, u16 form)
+    {
+        return u32(u16(species)) << 16 | form;
+    }
+}
+
+namespace pksm
+{
+    void SlotIndex::set(u8 box, u8 slot, const Key& key)
+    {
+        Slot position{box, slot};
+        auto old = keys.find(box << 8 | slot);
+        if (old != keys.end())
+        {
+            remove(position, old->second);
+            keys.erase(old);
+        }
+        if (key.species != Species::None)
+        {
+            add(position, key);
+            keys.emplace(box << 8 | slot, key);
+        }
+    }
+
+    void SlotIndex::add(const Slot& slot, const Key& key)
+    {
+        speciesSlots[species_key(key.species, key.form)].push_back(slot);
+        tsvSlots[key.TSV].push_back(slot);
+        heldItemSlots[key.heldItem].push_back(slot);
+        ballSlots[u8(key.ball)].push_back(slot);
+        if (key.shiny)
+        {
+            shinySlots.push_back(slot);
+        }
+    }
+
+    void SlotIndex::remove(const Slot& slot, const Key& key)
+    {
+        erase_slot(speciesSlots[species_key(key.species, key.form)], slot);
+        erase_slot(tsvSlots[key.TSV], slot);
+        erase_slot(heldItemSlots[key.heldItem], slot);
+        erase_slot(ballSlots[u8(key.ball)], slot);
+        if (key.shiny)
+        {
+            erase_slot(shinySlots, slot);
+        }
+    }
+
+    std::span<const SlotIndex::Slot> SlotIndex::species(Species species, u16 form) const
+    {
+        return find_slots(speciesSlots, species_key(species, form));
+    }
+
+    std::span<const SlotIndex::Slot> SlotIndex::TSV(u16 tsv) const
+    {
+        return find_slots(tsvSlots, tsv);
+    }
+
+    std::span<const SlotIndex::Slot> SlotIndex::heldItem(u16 item) const
+    {
+        return find_slots(heldItemSlots, item);
+    }
+}
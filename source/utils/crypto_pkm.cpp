@@ -0,0 +1,492 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#include "utils/crypto.hpp"
+#include "utils/endian.hpp"
+#include <algorithm>
+#include <cstring>
+
+#ifndef _PKSMCORE_CONFIGURED
+#include "PKSMCORE_CONFIG.h"
+#endif
+
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+#include <thread>
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define PKSM_LCG_X86
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define PKSM_LCG_NEON
+#include <arm_neon.h>
+#endif
+
+namespace pksm::crypto::pkm
+{
+    namespace internal
+    {
+        // seedStep applied steps times over, which is still of the form x * mult + add. Starting
+        // lanes one step apart and advancing each by the lane count keeps them in lockstep with
+        // the serial sequence
+        struct LcgJump
+        {
+            u32 mult;
+            u32 add;
+        };
+
+        constexpr LcgJump lcgJump(size_t steps)
+        {
+            LcgJump ret{1, 0};
+            for (size_t i = 0; i < steps; i++)
+            {
+                ret.mult *= 0x41C64E6D;
+                ret.add  = ret.add * 0x41C64E6D + 0x6073;
+            }
+            return ret;
+        }
+
+        static_assert(lcgJump(1).mult == 0x41C64E6D && lcgJump(1).add == 0x6073);
+
+        using KeystreamFunc = void (*)(u8* dst, const u8* src, size_t size, u32 seed);
+
+        // Fills states with the seeds for the next count words
+        void firstStates(u32* states, size_t count, u32 seed)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                seed      = seedStep(seed);
+                states[i] = seed;
+            }
+        }
+
+        // Finishes off the words that don't fill a whole vector; states[i] is word i's seed
+        void xorTail(u8* dst, const u8* src, size_t size, const u32* states)
+        {
+            for (size_t i = 0; i < size; i += 2, states++)
+            {
+                dst[i]     = src[i] ^ u8(*states >> 16);
+                dst[i + 1] = src[i + 1] ^ u8(*states >> 24);
+            }
+        }
+
+        void xorKeystreamGeneric(u8* dst, const u8* src, size_t size, u32 seed)
+        {
+            static constexpr size_t LANES = 4;
+            static constexpr LcgJump JUMP = lcgJump(LANES);
+
+            u32 states[LANES];
+            firstStates(states, LANES, seed);
+            size_t i = 0;
+            for (; i + LANES * 2 <= size; i += LANES * 2)
+            {
+                for (size_t lane = 0; lane < LANES; lane++)
+                {
+                    dst[i + lane * 2]     = src[i + lane * 2] ^ u8(states[lane] >> 16);
+                    dst[i + lane * 2 + 1] = src[i + lane * 2 + 1] ^ u8(states[lane] >> 24);
+                    states[lane]          = states[lane] * JUMP.mult + JUMP.add;
+                }
+            }
+            xorTail(dst + i, src + i, size - i, states);
+        }
+
+#if defined(PKSM_LCG_X86)
+        // SSE2 has no 32-bit low multiply, so put one together from two 32x32->64 multiplies
+        __attribute__((target("sse2"))) __m128i mullo32(__m128i a, __m128i b)
+        {
+            __m128i even = _mm_mul_epu32(a, b);
+            __m128i odd  = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+            return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+        }
+
+        // The keystream word is the top half of each state. An arithmetic shift sign-extends it,
+        // which makes the signed saturating pack keep it exactly
+        __attribute__((target("sse2"))) void xorKeystreamSse2(
+            u8* dst, const u8* src, size_t size, u32 seed)
+        {
+            static constexpr size_t WORDS = 8;
+            static constexpr LcgJump JUMP = lcgJump(WORDS);
+
+            alignas(16) u32 states[WORDS];
+            firstStates(states, WORDS, seed);
+            __m128i lo         = _mm_load_si128((const __m128i*)&states[0]);
+            __m128i hi         = _mm_load_si128((const __m128i*)&states[4]);
+            const __m128i mult = _mm_set1_epi32(JUMP.mult);
+            const __m128i add  = _mm_set1_epi32(JUMP.add);
+
+            size_t i = 0;
+            for (; i + WORDS * 2 <= size; i += WORDS * 2)
+            {
+                __m128i key = _mm_packs_epi32(_mm_srai_epi32(lo, 16), _mm_srai_epi32(hi, 16));
+                __m128i in  = _mm_loadu_si128((const __m128i*)(src + i));
+                _mm_storeu_si128((__m128i*)(dst + i), _mm_xor_si128(in, key));
+                lo = _mm_add_epi32(mullo32(lo, mult), add);
+                hi = _mm_add_epi32(mullo32(hi, mult), add);
+            }
+            _mm_store_si128((__m128i*)&states[0], lo);
+            _mm_store_si128((__m128i*)&states[4], hi);
+            xorTail(dst + i, src + i, size - i, states);
+        }
+
+        // Same as the SSE2 version, sixteen words at a time. The pack works within 128-bit
+        // halves, so the result needs its middle quadwords swapped back into order
+        __attribute__((target("avx2"))) void xorKeystreamAvx2(
+            u8* dst, const u8* src, size_t size, u32 seed)
+        {
+            static constexpr size_t WORDS = 16;
+            static constexpr LcgJump JUMP = lcgJump(WORDS);
+
+            alignas(32) u32 states[WORDS];
+            firstStates(states, WORDS, seed);
+            __m256i lo         = _mm256_load_si256((const __m256i*)&states[0]);
+            __m256i hi         = _mm256_load_si256((const __m256i*)&states[8]);
+            const __m256i mult = _mm256_set1_epi32(JUMP.mult);
+            const __m256i add  = _mm256_set1_epi32(JUMP.add);
+
+            size_t i = 0;
+            for (; i + WORDS * 2 <= size; i += WORDS * 2)
+            {
+                __m256i key = _mm256_permute4x64_epi64(
+                    _mm256_packs_epi32(_mm256_srai_epi32(lo, 16), _mm256_srai_epi32(hi, 16)),
+                    _MM_SHUFFLE(3, 1, 2, 0));
+                __m256i in = _mm256_loadu_si256((const __m256i*)(src + i));
+                _mm256_storeu_si256((__m256i*)(dst + i), _mm256_xor_si256(in, key));
+                lo = _mm256_add_epi32(_mm256_mullo_epi32(lo, mult), add);
+                hi = _mm256_add_epi32(_mm256_mullo_epi32(hi, mult), add);
+            }
+            _mm256_store_si256((__m256i*)&states[0], lo);
+            _mm256_store_si256((__m256i*)&states[8], hi);
+            xorTail(dst + i, src + i, size - i, states);
+        }
+#elif defined(PKSM_LCG_NEON)
+        void xorKeystreamNeon(u8* dst, const u8* src, size_t size, u32 seed)
+        {
+            static constexpr size_t WORDS = 8;
+            static constexpr LcgJump JUMP = lcgJump(WORDS);
+
+            u32 states[WORDS];
+            firstStates(states, WORDS, seed);
+            uint32x4_t lo         = vld1q_u32(&states[0]);
+            uint32x4_t hi         = vld1q_u32(&states[4]);
+            const uint32x4_t mult = vdupq_n_u32(JUMP.mult);
+            const uint32x4_t add  = vdupq_n_u32(JUMP.add);
+
+            size_t i = 0;
+            for (; i + WORDS * 2 <= size; i += WORDS * 2)
+            {
+                uint16x8_t key = vcombine_u16(vshrn_n_u32(lo, 16), vshrn_n_u32(hi, 16));
+                vst1q_u8(dst + i, veorq_u8(vld1q_u8(src + i), vreinterpretq_u8_u16(key)));
+                lo = vmlaq_u32(add, lo, mult);
+                hi = vmlaq_u32(add, hi, mult);
+            }
+            vst1q_u32(&states[0], lo);
+            vst1q_u32(&states[4], hi);
+            xorTail(dst + i, src + i, size - i, states);
+        }
+#endif
+
+        KeystreamFunc selectKeystream()
+        {
+#if defined(PKSM_LCG_X86)
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return xorKeystreamAvx2;
+            }
+            if (__builtin_cpu_supports("sse2"))
+            {
+                return xorKeystreamSse2;
+            }
+#elif defined(PKSM_LCG_NEON)
+            return xorKeystreamNeon;
+#endif
+            return xorKeystreamGeneric;
+        }
+
+        // Writes src XORed with the keystream to dst, which may be the same buffer
+        void xorKeystream(u8* dst, const u8* src, size_t size, u32 seed)
+        {
+            static const KeystreamFunc func = selectKeystream();
+            func(dst, src, size, seed);
+        }
+
+        // Stored layouts, mirroring what PK3 through PK9 do in encrypt() and decrypt(). The
+        // shuffled region runs from SHUFFLE_START to the end of the box data, and it's also the
+        // region the checksum is the sum of
+        struct Gen3Format
+        {
+            static constexpr size_t BOX_LENGTH      = 80;
+            static constexpr size_t PARTY_LENGTH    = 100;
+            static constexpr size_t SHUFFLE_START   = 32;
+            static constexpr size_t CHECKSUM_OFFSET = 0x1C;
+
+            static u8 shuffleValue(u32 pid) { return pid % 24; }
+
+            static u32 seed(const u8* entry, u32 pid, u16)
+            {
+                return pid ^ LittleEndian::convertTo<u32>(entry + 4);
+            }
+
+            static bool isEncrypted(const u8* entry, u16 regionSum)
+            {
+                return regionSum != LittleEndian::convertTo<u16>(entry + CHECKSUM_OFFSET);
+            }
+        };
+
+        template <size_t BoxLength, size_t PartyLength, size_t MarkerA, size_t MarkerB,
+            bool ChecksumSeed>
+        struct LcgFormat
+        {
+            static constexpr size_t BOX_LENGTH      = BoxLength;
+            static constexpr size_t PARTY_LENGTH    = PartyLength;
+            static constexpr size_t SHUFFLE_START   = 8;
+            static constexpr size_t CHECKSUM_OFFSET = 6;
+
+            static u8 shuffleValue(u32 pid) { return (pid >> 13) & 31; }
+
+            // Gen IV and V seed the box data with the checksum, later generations with the
+            // encryption constant
+            static u32 seed(const u8*, u32 pid, u16 checksum)
+            {
+                return ChecksumSeed ? checksum : pid;
+            }
+
+            // Fields that can't both be zero in an encrypted Pokemon
+            static bool isEncrypted(const u8* entry, u16)
+            {
+                if constexpr (MarkerA == MarkerB)
+                {
+                    return LittleEndian::convertTo<u32>(entry + MarkerA) != 0;
+                }
+                else
+                {
+                    return LittleEndian::convertTo<u16>(entry + MarkerA) != 0 &&
+                           LittleEndian::convertTo<u16>(entry + MarkerB) != 0;
+                }
+            }
+        };
+
+        using Gen4Format = LcgFormat<136, 236, 0x64, 0x64, true>;
+        using Gen5Format = LcgFormat<136, 220, 0x64, 0x64, true>;
+        using Gen6Format = LcgFormat<232, 260, 0xC8, 0x58, false>;
+        using Gen8Format = LcgFormat<0x148, 0x158, 0x70, 0xC0, false>;
+
+        // Don't bother splitting across threads unless each one gets at least this many Pokemon
+        constexpr size_t ENTRIES_PER_THREAD = 240;
+
+        u16 sum16(const u8* data, size_t length)
+        {
+            u16 ret = 0;
+            for (size_t i = 0; i < length; i += 2)
+            {
+                ret += LittleEndian::convertTo<u16>(data + i);
+            }
+            return ret;
+        }
+
+        template <typename Format>
+        bool isEncrypted(const u8* entry)
+        {
+            u16 sum = 0;
+            if constexpr (std::is_same_v<Format, Gen3Format>)
+            {
+                sum = sum16(
+                    entry + Format::SHUFFLE_START, Format::BOX_LENGTH - Format::SHUFFLE_START);
+            }
+            return Format::isEncrypted(entry, sum);
+        }
+
+        // XORs src into dst with the stored format's keystream
+        template <typename Format>
+        void cryptRegion(u8* dst, const u8* src, size_t length, u32 seed)
+        {
+            if constexpr (std::is_same_v<Format, Gen3Format>)
+            {
+                for (size_t i = 0; i < length; i += 4)
+                {
+                    LittleEndian::convertFrom<u32>(
+                        dst + i, LittleEndian::convertTo<u32>(src + i) ^ seed);
+                }
+            }
+            else
+            {
+                xorKeystream(dst, src, length, seed);
+            }
+        }
+
+        // Encrypting gathers the blocks into a stack buffer in their shuffled order, summing them
+        // for the checksum on the way, then XORs them back into place. Decrypting XORs into the
+        // buffer and scatters the blocks back. Either way the entry is read and written once
+        template <typename Format>
+        void cryptEntry(u8* entry, bool party, bool crypted)
+        {
+            static constexpr size_t LENGTH       = Format::BOX_LENGTH - Format::SHUFFLE_START;
+            static constexpr size_t BLOCK_LENGTH = LENGTH / 4;
+
+            u8* region = entry + Format::SHUFFLE_START;
+            u32 pid    = LittleEndian::convertTo<u32>(entry);
+            u8 sv      = Format::shuffleValue(pid);
+            if (isEncrypted<Format>(entry) != crypted)
+            {
+                return;
+            }
+
+            u8 temp[LENGTH];
+            if (crypted)
+            {
+                u16 checksum = LittleEndian::convertTo<u16>(entry + Format::CHECKSUM_OFFSET);
+                cryptRegion<Format>(temp, region, LENGTH, Format::seed(entry, pid, checksum));
+                for (size_t block = 0; block < 4; block++)
+                {
+                    std::memcpy(region + block * BLOCK_LENGTH,
+                        temp + BlockPositions[sv * 4 + block] * BLOCK_LENGTH, BLOCK_LENGTH);
+                }
+            }
+            else
+            {
+                u8 index = InvertedBlockPositions[sv] * 4;
+                u16 sum  = 0;
+                for (size_t block = 0; block < 4; block++)
+                {
+                    const u8* src = region + BlockPositions[index + block] * BLOCK_LENGTH;
+                    std::memcpy(temp + block * BLOCK_LENGTH, src, BLOCK_LENGTH);
+                    sum += sum16(src, BLOCK_LENGTH);
+                }
+                LittleEndian::convertFrom<u16>(entry + Format::CHECKSUM_OFFSET, sum);
+                cryptRegion<Format>(region, temp, LENGTH, Format::seed(entry, pid, sum));
+            }
+
+            // Gen III leaves party stats in the clear
+            if constexpr (!std::is_same_v<Format, Gen3Format>)
+            {
+                if (party)
+                {
+                    crypt<Format::PARTY_LENGTH - Format::BOX_LENGTH>(
+                        entry + Format::BOX_LENGTH, pid);
+                }
+            }
+        }
+
+        template <typename Format>
+        void cryptEntries(u8* data, size_t begin, size_t end, size_t entryLength, bool crypted)
+        {
+            bool party = entryLength == Format::PARTY_LENGTH;
+            for (size_t i = begin; i < end; i++)
+            {
+                cryptEntry<Format>(data + i * entryLength, party, crypted);
+            }
+        }
+
+        template <typename Format>
+        void cryptAll(std::span<u8> data, size_t entryLength, bool crypted)
+        {
+            if (entryLength != Format::BOX_LENGTH && entryLength != Format::PARTY_LENGTH)
+            {
+                return;
+            }
+            size_t count = data.size() / entryLength;
+
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+            cryptEntries<Format>(data.data(), 0, count, entryLength, crypted);
+#else
+            size_t threads = std::min<size_t>(
+                std::max(std::thread::hardware_concurrency(), 1u), count / ENTRIES_PER_THREAD);
+            if (threads <= 1)
+            {
+                cryptEntries<Format>(data.data(), 0, count, entryLength, crypted);
+                return;
+            }
+
+            size_t chunk = count / threads;
+            std::vector<std::thread> pool;
+            for (size_t i = 1; i < threads; i++)
+            {
+                pool.emplace_back(cryptEntries<Format>, data.data(), i * chunk,
+                    i == threads - 1 ? count : (i + 1) * chunk, entryLength, crypted);
+            }
+            cryptEntries<Format>(data.data(), 0, chunk, entryLength, crypted);
+            for (auto& thread : pool)
+            {
+                thread.join();
+            }
+#endif
+        }
+    }
+
+    void xorKeystream(u8* data, size_t size, u32 key)
+    {
+        internal::xorKeystream(data, data, size, key);
+    }
+
+    void cryptBoxData(Generation gen, std::span<u8> data, size_t entryLength, bool crypted)
+    {
+        switch (gen)
+        {
+            case Generation::THREE:
+                internal::cryptAll<internal::Gen3Format>(data, entryLength, crypted);
+                break;
+            case Generation::FOUR:
+                internal::cryptAll<internal::Gen4Format>(data, entryLength, crypted);
+                break;
+            case Generation::FIVE:
+                internal::cryptAll<internal::Gen5Format>(data, entryLength, crypted);
+                break;
+            case Generation::SIX:
+            case Generation::SEVEN:
+            case Generation::LGPE:
+                internal::cryptAll<internal::Gen6Format>(data, entryLength, crypted);
+                break;
+            case Generation::EIGHT:
+            case Generation::NINE:
+                internal::cryptAll<internal::Gen8Format>(data, entryLength, crypted);
+                break;
+            default:
+                break;
+        }
+    }
+
+    bool isEncrypted(Generation gen, const u8* entry)
+    {
+        switch (gen)
+        {
+            case Generation::THREE:
+                return internal::isEncrypted<internal::Gen3Format>(entry);
+            case Generation::FOUR:
+                return internal::isEncrypted<internal::Gen4Format>(entry);
+            case Generation::FIVE:
+                return internal::isEncrypted<internal::Gen5Format>(entry);
+            case Generation::SIX:
+            case Generation::SEVEN:
+            case Generation::LGPE:
+                return internal::isEncrypted<internal::Gen6Format>(entry);
+            case Generation::EIGHT:
+            case Generation::NINE:
+                return internal::isEncrypted<internal::Gen8Format>(entry);
+            default:
+                return false;
+        }
+    }
+}
@@ -25,8 +25,18 @@
  */
 
 #include "utils/crypto.hpp"
+#include <algorithm>
 #include <bit>
 
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define PKSM_SHA256_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) && (defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO))
+#define PKSM_SHA256_ARM
+#include <arm_neon.h>
+#endif
+
 #define SHA256_BLOCK_SIZE 32
 
 namespace
@@ -78,71 +88,224 @@ namespace pksm::crypto
             0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
     }
 
-    std::array<u8, 32> sha256(std::span<const u8> buf)
+    namespace
     {
-        SHA256 context;
-        context.update(buf);
-        return context.finish();
-    }
+        using TransformFunc = void (*)(std::array<u32, 8>&, const u8*, size_t);
 
-    void SHA256::update()
-    {
-        uint32_t a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
+        void transformGeneric(std::array<u32, 8>& state, const u8* blocks, size_t count)
+        {
+            for (; count > 0; count--, blocks += 64)
+            {
+                uint32_t a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
+
+                for (i = 0, j = 0; i < 16; ++i, j += 4)
+                {
+                    m[i] = (blocks[j] << 24) | (blocks[j + 1] << 16) | (blocks[j + 2] << 8) |
+                           (blocks[j + 3]);
+                }
+                for (; i < 64; ++i)
+                {
+                    m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
+                }
+
+                a = state[0];
+                b = state[1];
+                c = state[2];
+                d = state[3];
+                e = state[4];
+                f = state[5];
+                g = state[6];
+                h = state[7];
 
-        for (i = 0, j = 0; i < 16; ++i, j += 4)
+                for (i = 0; i < 64; ++i)
+                {
+                    t1 = h + EP1(e) + CH(e, f, g) + internal::sha256_table[i] + m[i];
+                    t2 = EP0(a) + MAJ(a, b, c);
+                    h  = g;
+                    g  = f;
+                    f  = e;
+                    e  = d + t1;
+                    d  = c;
+                    c  = b;
+                    b  = a;
+                    a  = t1 + t2;
+                }
+
+                state[0] += a;
+                state[1] += b;
+                state[2] += c;
+                state[3] += d;
+                state[4] += e;
+                state[5] += f;
+                state[6] += g;
+                state[7] += h;
+            }
+        }
+
+#if defined(PKSM_SHA256_X86)
+        // The SHA extensions keep the state as ABEF/CDGH halves and do two rounds per
+        // instruction, with four message words scheduled at a time
+        __attribute__((target("sha,sse4.1"))) void transformShaNi(
+            std::array<u32, 8>& state, const u8* blocks, size_t count)
         {
-            m[i] = (data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
+            const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+            __m128i tmp    = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&state[0]), 0xB1);
+            __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&state[4]), 0x1B);
+            __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+            state1         = _mm_blend_epi16(state1, tmp, 0xF0);
+
+            for (; count > 0; count--, blocks += 64)
+            {
+                const __m128i save0 = state0;
+                const __m128i save1 = state1;
+                __m128i msg[4];
+
+                for (int i = 0; i < 4; i++)
+                {
+                    msg[i] = _mm_shuffle_epi8(
+                        _mm_loadu_si128((const __m128i*)(blocks + i * 16)), byteSwap);
+                }
+
+                for (int i = 0; i < 16; i++)
+                {
+                    __m128i k = _mm_add_epi32(msg[i & 3],
+                        _mm_loadu_si128((const __m128i*)&internal::sha256_table[i * 4]));
+                    state1 = _mm_sha256rnds2_epu32(state1, state0, k);
+                    state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(k, 0x0E));
+
+                    if (i < 12)
+                    {
+                        __m128i next = _mm_sha256msg1_epu32(msg[i & 3], msg[(i + 1) & 3]);
+                        next         = _mm_add_epi32(
+                            next, _mm_alignr_epi8(msg[(i + 3) & 3], msg[(i + 2) & 3], 4));
+                        msg[i & 3] = _mm_sha256msg2_epu32(next, msg[(i + 3) & 3]);
+                    }
+                }
+
+                state0 = _mm_add_epi32(state0, save0);
+                state1 = _mm_add_epi32(state1, save1);
+            }
+
+            tmp    = _mm_shuffle_epi32(state0, 0x1B);
+            state1 = _mm_shuffle_epi32(state1, 0xB1);
+            _mm_storeu_si128((__m128i*)&state[0], _mm_blend_epi16(tmp, state1, 0xF0));
+            _mm_storeu_si128((__m128i*)&state[4], _mm_alignr_epi8(state1, tmp, 8));
         }
-        for (; i < 64; ++i)
+
+        bool hasShaNi()
         {
-            m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
+            unsigned int eax, ebx, ecx, edx;
+            if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || !(ecx & bit_SSE4_1) ||
+                !(ecx & bit_SSSE3))
+            {
+                return false;
+            }
+            if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+            {
+                return false;
+            }
+            return ebx & (1 << 29);
         }
+#elif defined(PKSM_SHA256_ARM)
+        void transformArm(std::array<u32, 8>& state, const u8* blocks, size_t count)
+        {
+            uint32x4_t state0 = vld1q_u32(&state[0]);
+            uint32x4_t state1 = vld1q_u32(&state[4]);
+
+            for (; count > 0; count--, blocks += 64)
+            {
+                const uint32x4_t save0 = state0;
+                const uint32x4_t save1 = state1;
+                uint32x4_t msg[4];
+
+                for (int i = 0; i < 4; i++)
+                {
+                    msg[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(blocks + i * 16)));
+                }
+
+                for (int i = 0; i < 16; i++)
+                {
+                    uint32x4_t k =
+                        vaddq_u32(msg[i & 3], vld1q_u32(&internal::sha256_table[i * 4]));
+                    uint32x4_t tmp = state0;
+                    state0         = vsha256hq_u32(state0, state1, k);
+                    state1         = vsha256h2q_u32(state1, tmp, k);
 
-        a = state[0];
-        b = state[1];
-        c = state[2];
-        d = state[3];
-        e = state[4];
-        f = state[5];
-        g = state[6];
-        h = state[7];
+                    if (i < 12)
+                    {
+                        msg[i & 3] = vsha256su1q_u32(vsha256su0q_u32(msg[i & 3], msg[(i + 1) & 3]),
+                            msg[(i + 2) & 3], msg[(i + 3) & 3]);
+                    }
+                }
 
-        for (i = 0; i < 64; ++i)
+                state0 = vaddq_u32(state0, save0);
+                state1 = vaddq_u32(state1, save1);
+            }
+
+            vst1q_u32(&state[0], state0);
+            vst1q_u32(&state[4], state1);
+        }
+#endif
+
+        TransformFunc selectTransform()
         {
-            t1 = h + EP1(e) + CH(e, f, g) + internal::sha256_table[i] + m[i];
-            t2 = EP0(a) + MAJ(a, b, c);
-            h  = g;
-            g  = f;
-            f  = e;
-            e  = d + t1;
-            d  = c;
-            c  = b;
-            b  = a;
-            a  = t1 + t2;
+#if defined(PKSM_SHA256_X86)
+            if (hasShaNi())
+            {
+                return transformShaNi;
+            }
+#elif defined(PKSM_SHA256_ARM)
+            return transformArm;
+#endif
+            return transformGeneric;
         }
+    }
 
-        state[0] += a;
-        state[1] += b;
-        state[2] += c;
-        state[3] += d;
-        state[4] += e;
-        state[5] += f;
-        state[6] += g;
-        state[7] += h;
+    std::array<u8, 32> sha256(std::span<const u8> buf)
+    {
+        SHA256 context;
+        context.update(buf);
+        return context.finish();
+    }
+
+    void SHA256::transform(const u8* blocks, size_t count)
+    {
+        static const TransformFunc func = selectTransform();
+        func(state, blocks, count);
     }
 
     void SHA256::update(std::span<const u8> buf)
     {
-        for (size_t i = 0; i < buf.size(); i++)
+        size_t i = 0;
+
+        // Top off a partially filled block first
+        if (dataLength > 0)
         {
-            data[dataLength++] = buf[i];
-            if (dataLength == 64)
+            size_t copy = std::min<size_t>(64 - dataLength, buf.size());
+            std::copy_n(buf.data(), copy, data + dataLength);
+            dataLength += copy;
+            i          += copy;
+            if (dataLength < 64)
             {
-                update();
-                bitLength  += 512;
-                dataLength = 0;
+                return;
             }
+            transform(data, 1);
+            bitLength  += 512;
+            dataLength = 0;
+        }
+
+        // Whole blocks are hashed straight out of the input
+        size_t blocks = (buf.size() - i) / 64;
+        if (blocks > 0)
+        {
+            transform(buf.data() + i, blocks);
+            bitLength += 512 * u64(blocks);
+            i         += blocks * 64;
         }
+
+        std::copy(buf.begin() + i, buf.end(), data);
+        dataLength = buf.size() - i;
     }
 
     std::array<u8, 32> SHA256::finish()
@@ -167,7 +330,7 @@ namespace pksm::crypto
             {
                 data[i++] = 0x00;
             }
-            update();
+            transform(data, 1);
             std::fill_n(data, 56, 0);
         }
 
@@ -181,7 +344,7 @@ namespace pksm::crypto
         data[58]  = bitLength >> 40;
         data[57]  = bitLength >> 48;
         data[56]  = bitLength >> 56;
-        update();
+        transform(data, 1);
 
         // Since this implementation uses little endian byte ordering and SHA uses big endian,
         // reverse all the bytes when copying the final state to the output hash.
@@ -26,7 +26,17 @@
 
 #include "utils/crypto.hpp"
 #include "utils/endian.hpp"
+#include <algorithm>
 #include <bit>
+#include <cstring>
+
+#ifndef _PKSMCORE_CONFIGURED
+#include "PKSMCORE_CONFIG.h"
+#endif
+
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+#include <thread>
+#endif
 
 namespace pksm::crypto::swsh
 {
@@ -60,6 +70,43 @@ namespace pksm::crypto::swsh
 
         // clang-format on
 
+        // The pad repeated eight times, which is a whole number of u64s. Because of that, the pad
+        // offset only has to be computed once per run instead of once per byte
+        constexpr size_t EXPANDED_XORPAD_SIZE = xorpad.size() * sizeof(u64);
+        alignas(u64) constexpr std::array<u8, EXPANDED_XORPAD_SIZE> expandedXorpad = []
+        {
+            std::array<u8, EXPANDED_XORPAD_SIZE> ret{};
+            for (size_t i = 0; i < ret.size(); i++)
+            {
+                ret[i] = xorpad[i % xorpad.size()];
+            }
+            return ret;
+        }();
+
+        // Don't bother splitting across threads unless each one gets at least this much
+        constexpr size_t XOR_BYTES_PER_THREAD = 0x100000;
+
+        // XORs data[begin, end) with the pad. begin must be a multiple of the expanded pad's size
+        void applyXorRange(u8* data, size_t begin, size_t end)
+        {
+            size_t i = begin;
+            for (; i + EXPANDED_XORPAD_SIZE <= end; i += EXPANDED_XORPAD_SIZE)
+            {
+                for (size_t j = 0; j < EXPANDED_XORPAD_SIZE; j += sizeof(u64))
+                {
+                    u64 word, pad;
+                    std::memcpy(&word, data + i + j, sizeof(u64));
+                    std::memcpy(&pad, expandedXorpad.data() + j, sizeof(u64));
+                    word ^= pad;
+                    std::memcpy(data + i + j, &word, sizeof(u64));
+                }
+            }
+            for (size_t j = 0; i < end; i++, j++)
+            {
+                data[i] ^= expandedXorpad[j];
+            }
+        }
+
         std::array<u8, 32> computeHash(u8* data, size_t length)
         {
             SHA256 context;
@@ -111,8 +158,35 @@ namespace pksm::crypto::swsh
 
             u32 next32()
             {
+                if (mCounter == 0)
+                {
+                    u32 ret = mSeed;
+                    advance(mSeed);
+                    return ret;
+                }
                 return next() | (u32(next()) << 8) | (u32(next()) << 16) | (u32(next()) << 24);
             }
+
+            // XORs the next length bytes of the stream into data. Once the stream is word-aligned,
+            // a whole state word covers four bytes at a time
+            void apply(u8* data, size_t length)
+            {
+                size_t i = 0;
+                for (; i < length && mCounter != 0; i++)
+                {
+                    data[i] ^= next();
+                }
+                for (; i + 4 <= length; i += 4)
+                {
+                    LittleEndian::convertFrom<u32>(
+                        data + i, LittleEndian::convertTo<u32>(data + i) ^ mSeed);
+                    advance(mSeed);
+                }
+                for (; i < length; i++)
+                {
+                    data[i] ^= next();
+                }
+            }
         };
 
         class CryptoException : public std::exception
@@ -132,18 +206,56 @@ namespace pksm::crypto::swsh
 
     void applyXor(std::shared_ptr<u8[]> data, size_t length)
     {
-        for (size_t i = 0; i < length - 32; i++)
+        applyXor(std::span{data.get(), length});
+    }
+
+    void applyXor(std::span<u8> data)
+    {
+        if (data.size() <= 32)
         {
-            data[i] ^= internal::xorpad[i % internal::xorpad.size()];
+            return;
         }
+        const size_t size = data.size() - 32;
+
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+        internal::applyXorRange(data.data(), 0, size);
+#else
+        size_t threads = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u),
+            size / internal::XOR_BYTES_PER_THREAD);
+        if (threads <= 1)
+        {
+            internal::applyXorRange(data.data(), 0, size);
+            return;
+        }
+
+        // Every chunk but the last is a whole number of expanded pads, so each starts at offset 0
+        size_t chunk = (size / threads) / internal::EXPANDED_XORPAD_SIZE;
+        chunk        *= internal::EXPANDED_XORPAD_SIZE;
+        std::vector<std::thread> pool;
+        for (size_t i = 1; i < threads; i++)
+        {
+            pool.emplace_back(internal::applyXorRange, data.data(), i * chunk,
+                i == threads - 1 ? size : (i + 1) * chunk);
+        }
+        internal::applyXorRange(data.data(), 0, chunk);
+        for (auto& thread : pool)
+        {
+            thread.join();
+        }
+#endif
     }
 
     void sign(std::shared_ptr<u8[]> data, size_t length)
     {
-        if (length > 32)
+        sign(std::span{data.get(), length});
+    }
+
+    void sign(std::span<u8> data)
+    {
+        if (data.size() > 32)
         {
-            auto hash = internal::computeHash(data.get(), length - 32);
-            std::copy(hash.begin(), hash.end(), data.get() + length - 32);
+            auto hash = internal::computeHash(data.data(), data.size() - 32);
+            std::copy(hash.begin(), hash.end(), data.end() - 32);
         }
     }
 
@@ -176,14 +288,77 @@ namespace pksm::crypto::swsh
         return ret;
     }
 
-    SCBlock::SCBlock(std::shared_ptr<u8[]> data, size_t& offset) : data(data), myOffset(offset)
+    SCBlockList::SCBlockList(std::shared_ptr<u8[]> data, size_t length)
     {
+        size_t offset = 0;
+        while (offset < length - 32)
+        {
+            blocks->push_back(SCBlock(data, offset));
+        }
+
+        // Keep the load factor at or below one half so that probe sequences stay short
+        while ((size_t(1) << indexBits) < blocks->size() * 2)
+        {
+            indexBits++;
+        }
+        index.assign(size_t(1) << indexBits, IndexEntry{0, EMPTY_SLOT});
+
+        const size_t mask = index.size() - 1;
+        for (u32 i = 0; i < blocks->size(); i++)
+        {
+            u32 key = (*blocks)[i].key();
+            // Fibonacci hashing; the top bits are the best mixed
+            size_t slot = indexBits == 0 ? 0 : (key * 0x9E3779B1) >> (32 - indexBits);
+            while (index[slot].block != EMPTY_SLOT)
+            {
+                slot = (slot + 1) & mask;
+            }
+            index[slot] = {key, i};
+        }
+    }
+
+    SCBlock* SCBlockList::find(u32 key) const
+    {
+        if (blocks->empty())
+        {
+            return nullptr;
+        }
+
+        const size_t mask = index.size() - 1;
+        size_t slot       = indexBits == 0 ? 0 : (key * 0x9E3779B1) >> (32 - indexBits);
+        while (index[slot].block != EMPTY_SLOT)
+        {
+            if (index[slot].key == key)
+            {
+                return &(*blocks)[index[slot].block];
+            }
+            slot = (slot + 1) & mask;
+        }
+        return nullptr;
+    }
+
+    std::shared_ptr<SCBlock> SCBlockList::get(u32 key) const
+    {
+        SCBlock* block = find(key);
+        if (block == nullptr)
+        {
+            return nullptr;
+        }
+        return std::shared_ptr<SCBlock>(blocks, block);
+    }
+
+    SCBlock::SCBlock(std::shared_ptr<u8[]> data, size_t& offset)
+        : data(data), myOffset(offset)
+    {
+        // Only the header is decrypted here, and only into the members: the block stays encrypted
+        // in place until something asks for its data, so untouched blocks never pay for crypto
+
         // Key size
         offset += 4;
 
         internal::XorShift32 xorShift(key());
 
-        type = SCBlockType(data[offset] ^= xorShift.next());
+        type = SCBlockType(data[offset] ^ xorShift.next());
 
         switch (type)
         {
@@ -194,33 +369,17 @@ namespace pksm::crypto::swsh
                 offset++;
                 break;
             case SCBlockType::Object:
-            {
                 dataLength =
                     LittleEndian::convertTo<u32>(data.get() + offset + 1) ^ xorShift.next32();
-                LittleEndian::convertFrom<u32>(data.get() + offset + 1, dataLength);
-                for (size_t i = 0; i < dataLength; i++)
-                {
-                    data[offset + 5 + i] ^= xorShift.next();
-                }
                 offset += 5 + dataLength;
-            }
-            break;
+                break;
             case SCBlockType::Array:
-            {
                 dataLength =
                     LittleEndian::convertTo<u32>(data.get() + offset + 1) ^ xorShift.next32();
-                LittleEndian::convertFrom<u32>(data.get() + offset + 1, dataLength);
-                subtype = SCBlockType(data[offset + 5] ^= xorShift.next());
+                subtype = SCBlockType(data[offset + 5] ^ xorShift.next());
                 switch (subtype)
                 {
-                    case SCBlockType::Bool3:
-                        // An array of booleans
-                        for (size_t i = 0; i < dataLength; i++)
-                        {
-                            data[offset + 6 + i] ^= xorShift.next();
-                        }
-                        offset += 6 + dataLength;
-                        break;
+                    case SCBlockType::Bool3: // An array of booleans
                     case SCBlockType::U8:
                     case SCBlockType::U16:
                     case SCBlockType::U32:
@@ -231,22 +390,14 @@ namespace pksm::crypto::swsh
                     case SCBlockType::S64:
                     case SCBlockType::Float:
                     case SCBlockType::Double:
-                    {
-                        size_t entrySize = arrayEntrySize(subtype);
-                        for (size_t i = 0; i < dataLength * entrySize; i++)
-                        {
-                            data[offset + 6 + i] ^= xorShift.next();
-                        }
-                        offset += 6 + (dataLength * entrySize);
-                    }
-                    break;
+                        offset += 6 + (dataLength * arrayEntrySize(subtype));
+                        break;
                     default:
                         throw internal::CryptoException(
                             "Decoding block: Key: " + std::to_string(key()) +
                             "\nSubtype: " + std::to_string(u8(type)));
                 }
-            }
-            break;
+                break;
             case SCBlockType::U8:
             case SCBlockType::U16:
             case SCBlockType::U32:
@@ -257,15 +408,8 @@ namespace pksm::crypto::swsh
             case SCBlockType::S64:
             case SCBlockType::Float:
             case SCBlockType::Double:
-            {
-                size_t entrySize = arrayEntrySize(type);
-                for (size_t i = 0; i < entrySize; i++)
-                {
-                    data[offset + 1 + i] ^= xorShift.next();
-                }
-                offset += 1 + entrySize;
-            }
-            break;
+                offset += 1 + arrayEntrySize(type);
+                break;
             default:
                 throw internal::CryptoException("Decoding block: Key: " + std::to_string(key()) +
                                                 "\nType: " + std::to_string(u8(type)));
@@ -277,10 +421,7 @@ namespace pksm::crypto::swsh
         if (!currentlyEncrypted)
         {
             internal::XorShift32 xorShift(key());
-            for (size_t i = 0; i < encryptedDataSize() - 4; i++)
-            {
-                data[myOffset + 4 + i] ^= xorShift.next();
-            }
+            xorShift.apply(data.get() + myOffset + 4, encryptedDataSize() - 4);
 
             currentlyEncrypted = true;
         }
@@ -291,15 +432,21 @@ namespace pksm::crypto::swsh
         if (currentlyEncrypted)
         {
             internal::XorShift32 xorShift(key());
-            for (size_t i = 0; i < encryptedDataSize() - 4; i++)
-            {
-                data[myOffset + 4 + i] ^= xorShift.next();
-            }
+            xorShift.apply(data.get() + myOffset + 4, encryptedDataSize() - 4);
 
             currentlyEncrypted = false;
         }
     }
 
+    void SCBlock::encryptInto(std::span<u8> image) const
+    {
+        if (!currentlyEncrypted)
+        {
+            internal::XorShift32 xorShift(key());
+            xorShift.apply(image.data() + myOffset + 4, encryptedDataSize() - 4);
+        }
+    }
+
     u32 SCBlock::key() const
     {
         return LittleEndian::convertTo<u32>(&data[myOffset]);
@@ -361,7 +508,7 @@ namespace pksm::crypto::swsh
         }
     }
 
-    size_t SCBlock::encryptedDataSize()
+    size_t SCBlock::encryptedDataSize() const
     {
         static constexpr int baseSize = 4 + 1; // key + type
         switch (type)
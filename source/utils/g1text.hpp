@@ -27,6 +27,7 @@
 #ifndef G1TEXT_HPP
 #define G1TEXT_HPP
 
+#include "textLookup.hpp"
 #include "utils/coretypes.h"
 #include <unordered_map>
 
@@ -81,6 +82,12 @@ namespace pksm::internal
         u'や', u'ゆ', u'よ', u'ら', u'リ', u'る', u'れ', u'ろ', u'わ', u'を', u'ん', u'っ', u'ゃ',
         u'ゅ', u'ょ', u'ー', u'?', u'!', u'ァ', u'ゥ', u'ェ', u'♂', u'ォ', u'♀', u'０', u'１',
         u'２', u'３', u'４', u'５', u'６', u'７', u'８', u'９'};
+
+    // For finding characters and values in the tables above
+    constexpr auto G1ENValsLookup  = textLookup<G1ENVals>();
+    constexpr auto G1ENCharsLookup = textLookup<G1ENChars>();
+    constexpr auto G1JPValsLookup  = textLookup<G1JPVals>();
+    constexpr auto G1JPCharsLookup = textLookup<G1JPChars>();
 }
 
 #endif
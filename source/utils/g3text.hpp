@@ -27,6 +27,7 @@
 #ifndef G3TEXT_HPP
 #define G3TEXT_HPP
 
+#include "textLookup.hpp"
 #include <array>
 
 namespace pksm::internal
@@ -71,6 +72,10 @@ namespace pksm::internal
         u'ｃ', u'ｄ', u'ｅ', u'ｆ', u'ｇ', u'ｈ', u'ｉ', u'ｊ', u'ｋ', u'ｌ', u'ｍ', u'ｎ', u'ｏ',
         u'ｐ', u'ｑ', u'ｒ', u'ｓ', u'ｔ', u'ｕ', u'ｖ', u'ｗ', u'ｘ', u'ｙ', u'ｚ', u'0', u':',
         u'Ä', u'Ö', u'Ü', u'ä', u'ö', u'ü'};
+
+    // For finding characters and values in the tables above
+    constexpr auto G3_ENLookup = textLookup<G3_EN>();
+    constexpr auto G3_JPLookup = textLookup<G3_JP>();
 }
 
 #endif
@@ -27,6 +27,7 @@
 #ifndef G4TEXT_H
 #define G4TEXT_H
 
+#include "textLookup.hpp"
 #include "utils/coretypes.h"
 #include <array>
 
@@ -436,6 +437,10 @@ namespace pksm::internal
         4357, 4358, 4359, 4360, 4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368, 4369, 4370, 4449,
         4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457, 4461, 4462, 4466, 4467, 4469, 47252, 49968,
         50108, 50388, 52012, 65535};
+
+    // For finding characters and values in the tables above
+    inline constexpr auto G4ValuesLookup = textLookup<G4Values>();
+    inline constexpr auto G4CharsLookup  = textLookup<G4Chars>();
 }
 
 #endif
@@ -25,11 +25,93 @@
  */
 
 #include "utils/io.hpp"
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#if __has_include(<sys/mman.h>)
+#include <sys/mman.h>
+#define PKSM_HAS_MMAP
+#endif
 
 bool io::exists(const std::string& name)
 {
     struct stat buffer;
     return (stat(name.c_str(), &buffer) == 0);
 }
+
+std::shared_ptr<u8[]> io::mapFile(const std::string& name, size_t& length)
+{
+    length = 0;
+
+    int fd = open(name.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0)
+    {
+        close(fd);
+        return nullptr;
+    }
+    size_t size = info.st_size;
+
+#ifdef PKSM_HAS_MMAP
+    int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    // Every save constructor touches the whole file, so fault it all in at once
+    flags |= MAP_POPULATE;
+#endif
+    void* mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+    if (mapped != MAP_FAILED)
+    {
+        close(fd);
+        length = size;
+        return std::shared_ptr<u8[]>(
+            static_cast<u8*>(mapped), [size](u8* p) { munmap(p, size); });
+    }
+#endif
+
+    std::shared_ptr<u8[]> ret = std::shared_ptr<u8[]>(new u8[size]);
+    size_t done               = 0;
+    while (done < size)
+    {
+        ssize_t got = read(fd, ret.get() + done, size - done);
+        if (got <= 0)
+        {
+            close(fd);
+            return nullptr;
+        }
+        done += got;
+    }
+    close(fd);
+
+    length = size;
+    return ret;
+}
+
+bool io::writeFile(const std::string& name, std::span<const u8> data)
+{
+    int fd = open(name.c_str(), O_WRONLY | O_CREAT, 0644);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    size_t done = 0;
+    while (done < data.size())
+    {
+        ssize_t written = write(fd, data.data() + done, data.size() - done);
+        if (written <= 0)
+        {
+            close(fd);
+            return false;
+        }
+        done += written;
+    }
+
+    // Only ever shrinks the file after everything has been written, never while it may be mapped
+    bool ret = ftruncate(fd, data.size()) == 0;
+    return close(fd) == 0 && ret;
+}
@@ -32,41 +32,92 @@
 #include "PKSMCORE_CONFIG.h"
 #endif
 
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+#include <atomic>
+#endif
+
 namespace
 {
 #ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
-    pcg32 randomNumbers;
+    pcg32 generator;
     std::uniform_int_distribution<u32> distrib;
     bool seeded = false;
 #else
-    thread_local pcg32 randomNumbers;
+    thread_local pcg32 generator;
     thread_local std::uniform_int_distribution<u32> distrib;
-    thread_local bool seeded = false;
+    thread_local bool seeded    = false;
+    std::atomic<u64> nextStream = 0;
 #endif
+
+    void seedIfNeeded()
+    {
+        if (!seeded)
+        {
+            DateTime now      = DateTime::now();
+            std::seed_seq seq = std::initializer_list<u32>{
+                now.year(), now.month(), now.day(), now.hour(), now.minute(), now.second()};
+            pksm::seedRand(seq);
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+            // Threads started in the same second would otherwise draw exactly the same numbers
+            generator.set_stream(nextStream++);
+#endif
+        }
+    }
 }
 
 u32 pksm::randomNumber(u32 minInclusive, u32 maxInclusive)
 {
-    if (!seeded)
+    seedIfNeeded();
+
+    return distrib(
+        generator, std::uniform_int_distribution<u32>::param_type{minInclusive, maxInclusive});
+}
+
+void pksm::randomNumbers(std::span<u32> out)
+{
+    seedIfNeeded();
+
+    for (u32& number : out)
     {
-        DateTime now      = DateTime::now();
-        std::seed_seq seq = std::initializer_list<u32>{
-            now.year(), now.month(), now.day(), now.hour(), now.minute(), now.second()};
-        seedRand(seq);
+        number = generator();
     }
+}
 
-    return distrib(
-        randomNumbers, std::uniform_int_distribution<u32>::param_type{minInclusive, maxInclusive});
+void pksm::randomNumbers(std::span<u32> out, u32 minInclusive, u32 maxInclusive)
+{
+    seedIfNeeded();
+
+    std::uniform_int_distribution<u32> numbers{minInclusive, maxInclusive};
+    for (u32& number : out)
+    {
+        number = numbers(generator);
+    }
+}
+
+void pksm::RandomStream::fill(std::span<u32> out)
+{
+    for (u32& number : out)
+    {
+        number = (*this)();
+    }
+}
+
+void pksm::RandomStream::fill(std::span<u32> out, u32 minInclusive, u32 maxInclusive)
+{
+    for (u32& number : out)
+    {
+        number = this->number(minInclusive, maxInclusive);
+    }
 }
 
 void pksm::seedRand(u32 seed)
 {
-    randomNumbers.seed(seed);
+    generator.seed(seed);
     seeded = true;
 }
 
 void pksm::seedRand(std::seed_seq& seed)
 {
-    randomNumbers.seed(seed);
+    generator.seed(seed);
     seeded = true;
 }
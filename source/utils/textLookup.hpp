@@ -0,0 +1,108 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2022 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+#ifndef TEXTLOOKUP_HPP
+#define TEXTLOOKUP_HPP
+
+#include "utils/coretypes.h"
+#include <array>
+
+namespace pksm::internal
+{
+    template <size_t Pages>
+    class TextLookup;
+
+    template <const auto& Table>
+    consteval auto textLookup();
+
+    // Finds the index of a value in one of the text tables in constant time. The high byte of the
+    // value picks a page of 256 indices and the low byte an entry in it; only pages that hold some
+    // value in the table are stored
+    template <size_t Pages>
+    class TextLookup
+    {
+    private:
+        std::array<u8, 256> pageOf{};
+        // Page 0 is left empty for values that no page holds. Entries are index + 1, or 0 for
+        // values missing from the table
+        std::array<std::array<u16, 256>, Pages + 1> pages{};
+
+        template <const auto& Table>
+        friend consteval auto textLookup();
+
+    public:
+        // The index std::find would find value at, or -1 if value isn't in the table
+        [[nodiscard]] constexpr int find(char32_t value) const
+        {
+            if (value > 0xFFFF)
+            {
+                return -1;
+            }
+            return int(pages[pageOf[value >> 8]][value & 0xFF]) - 1;
+        }
+    };
+
+    template <const auto& Table>
+    consteval auto textLookup()
+    {
+        constexpr size_t pageCount = []
+        {
+            std::array<bool, 256> used{};
+            for (auto value : Table)
+            {
+                used[u16(value) >> 8] = true;
+            }
+            size_t ret = 0;
+            for (bool page : used)
+            {
+                ret += page;
+            }
+            return ret;
+        }();
+        static_assert(pageCount < 256 && Table.size() < 0xFFFF);
+
+        TextLookup<pageCount> ret;
+        u8 nextPage = 1;
+        for (size_t i = 0; i < Table.size(); i++)
+        {
+            u16 value = u16(Table[i]);
+            u8& page  = ret.pageOf[value >> 8];
+            if (page == 0)
+            {
+                page = nextPage++;
+            }
+            // Later duplicates are left alone, since std::find stops at the first
+            u16& entry = ret.pages[page][value & 0xFF];
+            if (entry == 0)
+            {
+                entry = i + 1;
+            }
+        }
+        return ret;
+    }
+}
+
+#endif
@@ -719,15 +719,13 @@ std::string StringUtils::getString4(const u8* data, int ofs, int len)
         {
             break;
         }
-        auto found =
-            std::find(pksm::internal::G4Values.begin(), pksm::internal::G4Values.end(), temp);
+        int found = pksm::internal::G4ValuesLookup.find(temp);
         // Treat an invalid value as a terminator
-        if (found == pksm::internal::G4Values.end())
+        if (found < 0)
         {
             break;
         }
-        u16 codepoint =
-            pksm::internal::G4Chars[std::distance(pksm::internal::G4Values.begin(), found)];
+        u16 codepoint = pksm::internal::G4Chars[found];
         if (codepoint == 0xFFFF)
         {
             break;
@@ -746,12 +744,8 @@ std::vector<u16> StringUtils::stringToG4(const std::string_view& v)
     {
         auto [codepoint, size] = UTF8toCodepoint(v.data() + charIndex, v.length() - charIndex);
 
-        auto found =
-            std::find(pksm::internal::G4Chars.begin(), pksm::internal::G4Chars.end(), codepoint);
-        ret.push_back(
-            found != pksm::internal::G4Chars.end()
-                ? pksm::internal::G4Values[std::distance(pksm::internal::G4Chars.begin(), found)]
-                : 0x0000);
+        int found = pksm::internal::G4CharsLookup.find(codepoint);
+        ret.push_back(found >= 0 ? pksm::internal::G4Values[found] : 0x0000);
 
         charIndex += size;
     }
@@ -769,12 +763,9 @@ void StringUtils::setString4(u8* data, const std::string_view& v, int ofs, int l
     {
         auto [codepoint, size] = UTF8toCodepoint(v.data() + charIndex, v.length() - charIndex);
 
-        auto found =
-            std::find(pksm::internal::G4Chars.begin(), pksm::internal::G4Chars.end(), codepoint);
-        LittleEndian::convertFrom<u16>(data + ofs + outIndex++ * 2,
-            found != pksm::internal::G4Chars.end()
-                ? pksm::internal::G4Values[std::distance(pksm::internal::G4Chars.begin(), found)]
-                : 0x0000);
+        int found = pksm::internal::G4CharsLookup.find(codepoint);
+        LittleEndian::convertFrom<u16>(
+            data + ofs + outIndex++ * 2, found >= 0 ? pksm::internal::G4Values[found] : 0x0000);
 
         charIndex += size;
     }
@@ -886,7 +877,6 @@ std::string StringUtils::getString3(const u8* data, int ofs, int len, bool jp)
 void StringUtils::setString3(
     u8* data, const std::string_view& v, int ofs, int len, bool jp, int padTo, u8 padWith)
 {
-    auto& characters   = jp ? pksm::internal::G3_JP : pksm::internal::G3_EN;
     std::u16string str = StringUtils::UTF8toUTF16(v);
     if (jp)
     {
@@ -896,10 +886,11 @@ void StringUtils::setString3(
     size_t outPos;
     for (outPos = 0; outPos < std::min((size_t)len, str.size()); outPos++)
     {
-        auto it = std::find(characters.begin(), characters.end(), str[outPos]);
-        if (it != characters.end())
+        int found = jp ? pksm::internal::G3_JPLookup.find(str[outPos])
+                       : pksm::internal::G3_ENLookup.find(str[outPos]);
+        if (found >= 0)
         {
-            data[ofs + outPos] = (u8)std::distance(characters.begin(), it);
+            data[ofs + outPos] = (u8)found;
         }
         else
         {
@@ -1021,14 +1012,12 @@ std::string StringUtils::getString1(
     {
         for (int i = 0; i < len; i++)
         {
-            auto found = std::find(
-                pksm::internal::G1JPVals.begin(), pksm::internal::G1JPVals.end(), data[i + ofs]);
-            if (found == pksm::internal::G1JPVals.end())
+            int found = pksm::internal::G1JPValsLookup.find(data[i + ofs]);
+            if (found < 0)
             {
                 break; // treat invalid character as terminator
             }
-            char16_t codepoint =
-                pksm::internal::G1JPChars[std::distance(pksm::internal::G1JPVals.begin(), found)];
+            char16_t codepoint = pksm::internal::G1JPChars[found];
             if (codepoint == u'\0')
             {
                 break;
@@ -1056,14 +1045,12 @@ std::string StringUtils::getString1(
     {
         for (int i = 0; i < len; i++)
         {
-            auto found = std::find(
-                pksm::internal::G1ENVals.begin(), pksm::internal::G1ENVals.end(), data[i + ofs]);
-            if (found == pksm::internal::G1ENVals.end())
+            int found = pksm::internal::G1ENValsLookup.find(data[i + ofs]);
+            if (found < 0)
             {
                 break; // treat invalid character as terminator
             }
-            char16_t codepoint =
-                pksm::internal::G1ENChars[std::distance(pksm::internal::G1ENVals.begin(), found)];
+            char16_t codepoint = pksm::internal::G1ENChars[found];
             if (codepoint == u'\0')
             {
                 break;
@@ -1110,14 +1097,12 @@ void StringUtils::setString1(u8* data, const std::string_view& v, int ofs, int l
 
             codepoint = tofullwidth(codepointToUCS2(codepoint));
 
-            auto found = std::find(
-                pksm::internal::G1JPChars.begin(), pksm::internal::G1JPChars.end(), codepoint);
-            if (found == pksm::internal::G1JPChars.end())
+            int found = pksm::internal::G1JPCharsLookup.find(codepoint);
+            if (found < 0)
             {
                 break;
             }
-            data[ofs + outPos++] =
-                pksm::internal::G1JPVals[std::distance(pksm::internal::G1JPChars.begin(), found)];
+            data[ofs + outPos++] = pksm::internal::G1JPVals[found];
 
             inPos += advance;
         }
@@ -1128,14 +1113,12 @@ void StringUtils::setString1(u8* data, const std::string_view& v, int ofs, int l
         {
             auto [codepoint, advance] = UTF8toCodepoint(v.data() + inPos, v.size() - inPos);
 
-            auto found = std::find(pksm::internal::G1ENChars.begin(),
-                pksm::internal::G1ENChars.end(), codepointToUCS2(codepoint));
-            if (found == pksm::internal::G1ENChars.end())
+            int found = pksm::internal::G1ENCharsLookup.find(codepointToUCS2(codepoint));
+            if (found < 0)
             {
                 break;
             }
-            data[ofs + outPos++] =
-                pksm::internal::G1ENVals[std::distance(pksm::internal::G1ENChars.begin(), found)];
+            data[ofs + outPos++] = pksm::internal::G1ENVals[found];
 
             inPos += advance;
         }
@@ -1174,33 +1157,30 @@ std::string StringUtils::getString2(
     {
         if (data[ofs + inPos] <= 0xB)
         {
-            auto found = std::find(pksm::internal::G2KORVals.begin(),
-                pksm::internal::G2KORVals.end(), BigEndian::convertTo<u16>(data + ofs + inPos));
-            if (found == pksm::internal::G2KORVals.end())
+            int found =
+                pksm::internal::G2KORValsLookup.find(BigEndian::convertTo<u16>(data + ofs + inPos));
+            if (found < 0)
             {
                 break; // treat invalid value as terminator
             }
 
             inPos += 2;
 
-            auto [data, size] = codepointToUTF8(pksm::internal::G2KORChars[std::distance(
-                pksm::internal::G2KORVals.begin(), found)]);
+            auto [data, size] = codepointToUTF8(pksm::internal::G2KORChars[found]);
 
             ret.append(data.data(), size);
         }
         else
         {
-            auto found = std::find(pksm::internal::G1ENVals.begin(), pksm::internal::G1ENVals.end(),
-                data[ofs + inPos]);
-            if (found == pksm::internal::G1ENVals.end())
+            int found = pksm::internal::G1ENValsLookup.find(data[ofs + inPos]);
+            if (found < 0)
             {
                 break; // treat invalid value as terminator
             }
 
             inPos++;
 
-            char16_t codepoint =
-                pksm::internal::G1ENChars[std::distance(pksm::internal::G1ENVals.begin(), found)];
+            char16_t codepoint = pksm::internal::G1ENChars[found];
 
             if (codepoint == u'\0')
             {
@@ -1238,24 +1218,20 @@ void StringUtils::setString2(u8* data, const std::string_view& v, int ofs, int l
 
         codepoint = tofullwidth(codepointToUCS2(codepoint));
 
-        auto found = std::find(
-            pksm::internal::G2KORChars.begin(), pksm::internal::G2KORChars.end(), codepoint);
-        if (found == pksm::internal::G2KORChars.end())
+        int found = pksm::internal::G2KORCharsLookup.find(codepoint);
+        if (found < 0)
         {
-            auto found = std::find(
-                pksm::internal::G1ENChars.begin(), pksm::internal::G1ENChars.end(), codepoint);
-            if (found == pksm::internal::G1ENChars.end())
+            int found = pksm::internal::G1ENCharsLookup.find(codepoint);
+            if (found < 0)
             {
                 break; // treat invalid character as terminator
             }
 
-            data[ofs + outPos++] =
-                pksm::internal::G1ENVals[std::distance(pksm::internal::G1ENChars.begin(), found)];
+            data[ofs + outPos++] = pksm::internal::G1ENVals[found];
         }
         else
         {
-            u16 val =
-                pksm::internal::G2KORVals[std::distance(pksm::internal::G2KORChars.begin(), found)];
+            u16 val = pksm::internal::G2KORVals[found];
             BigEndian::convertFrom<u16>(data + outPos, val);
             outPos += 2; // needs to be incremented twice, not just once
         }